@@ -0,0 +1,96 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/grafo.h"
+#include "include/gerador.h"
+#include "include/bfs.h"
+
+// Benchmark de regressão sobre grafos sintéticos. Com os parâmetros padrão roda em
+// poucos segundos; para testar contagens acima de 2^31 arestas use, por exemplo,
+// "./benchmark 100000000 2200000000" numa máquina com memória suficiente.
+
+static double segundosDesde(clock_t inicio) {
+    return (double)(clock() - inicio) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[]) {
+    int numVertices = argc > 1 ? atoi(argv[1]) : 1000000;
+    long long numArestas = argc > 2 ? atoll(argv[2]) : 8000000LL;
+    unsigned long long semente = argc > 3 ? strtoull(argv[3], NULL, 10) : 42ULL;
+
+    if (numVertices <= 0 || numArestas < 0) {
+        printf("Uso: %s [numVertices] [numArestas] [semente]\n", argv[0]);
+        return 1;
+    }
+
+    printf("Grafo sintético: %d vértices, %lld arestas (semente %llu)\n", numVertices, numArestas, semente);
+
+    clock_t inicio = clock();
+    Grafo *grafo = gerarGrafoSintetico(numVertices, numArestas, 100, semente, LISTA_ADJACENCIA, 1);
+    printf("Geração: %.3f s\n", segundosDesde(inicio));
+
+    int falhas = 0;
+
+    // As contagens de arestas não podem estourar
+    if (grafo->numArestas != numArestas) {
+        printf("FALHA: numArestas = %lld, esperado %lld\n", grafo->numArestas, numArestas);
+        falhas++;
+    }
+
+    inicio = clock();
+    EstatisticasGrafo *stats = calcularEstatisticasGrafo(grafo);
+    printf("Estatísticas: %.3f s (grau médio %.2f, mínimo %d, máximo %d)\n",
+           segundosDesde(inicio), stats->grauMedio, stats->grauMinimo, stats->grauMaximo);
+    if (stats->numArestas != numArestas) {
+        printf("FALHA: estatísticas contaram %lld arestas, esperado %lld\n", stats->numArestas, numArestas);
+        falhas++;
+    }
+    free(stats);
+
+    int *visitados = (int *)calloc(numVertices, sizeof(int));
+    int *pais = (int *)malloc((size_t)numVertices * sizeof(int));
+    int *niveis = (int *)malloc((size_t)numVertices * sizeof(int));
+    double *distancia = (double *)malloc((size_t)numVertices * sizeof(double));
+
+    inicio = clock();
+    bfsComFilaArvore(grafo, 0, visitados, NULL, pais, niveis, NULL, SAIDA_TEXTO);
+    printf("BFS: %.3f s\n", segundosDesde(inicio));
+
+    inicio = clock();
+    obterCSR(grafo);
+    obterCSRReverso(grafo);
+    printf("Construção da CSR: %.3f s\n", segundosDesde(inicio));
+
+    int *niveisOtimizada = (int *)malloc((size_t)numVertices * sizeof(int));
+    for (int v = 0; v < numVertices; v++) {
+        visitados[v] = 0;
+    }
+    inicio = clock();
+    bfsDirecaoOtimizada(grafo, 0, visitados, pais, niveisOtimizada);
+    printf("BFS com otimização de direção: %.3f s\n", segundosDesde(inicio));
+    for (int v = 0; v < numVertices; v++) {
+        if (visitados[v] && niveisOtimizada[v] != niveis[v]) {
+            printf("FALHA: nível do vértice %d difere entre as BFS\n", v + 1);
+            falhas++;
+            break;
+        }
+    }
+    free(niveisOtimizada);
+
+    inicio = clock();
+    dijkstraHeap(grafo, 0, 0, distancia, pais);
+    printf("Dijkstra (heap): %.3f s\n", segundosDesde(inicio));
+
+    free(visitados);
+    free(pais);
+    free(niveis);
+    free(distancia);
+    liberarGrafo(grafo);
+
+    if (falhas > 0) {
+        printf("%d falha(s) encontrada(s)\n", falhas);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,45 @@
+#ifndef ALT_H
+#define ALT_H
+
+#include "grafo.h"
+
+// Número padrão de marcos e quantos deles são usados em cada consulta (os que dão o
+// maior limite inferior entre origem e destino)
+#define MARCOS_PADRAO_ALT 16
+#define MARCOS_ATIVOS_ALT 4
+
+// Índice ALT (A*, marcos e desigualdade triangular) para consultas origem-destino.
+// As tabelas guardam, para cada vértice v e marco L, d(L, v) e d(v, L) lado a lado
+// (distanciasDe[v * numMarcos + i]); em grafos não direcionados as duas são a mesma.
+// O estado da consulta usa as gerações do espaço de trabalho, então cada consulta custa
+// apenas o que visita. O grafo não pode ser alterado enquanto o índice existir, e o
+// índice atende uma consulta por vez.
+typedef struct {
+    int numVertices;
+    int numMarcos;
+    int *marcos;
+    double *distanciasDe;       // d(marco, v)
+    double *distanciasPara;     // d(v, marco)
+    GrafoCSR *csr;
+    EspacoTrabalho *espaco;
+    double *custos;             // Distância provisória desde a origem
+    double *estimativas;        // Limite inferior até o destino
+    int *pais;
+    int ativos[MARCOS_ATIVOS_ALT];
+    int numAtivos;
+    int numVisitados;           // Vértices finalizados na última consulta
+} IndiceAlt;
+
+// Escolhe os marcos pela heurística do mais distante (cada novo marco é o vértice mais
+// longe dos já escolhidos; vértices não alcançados têm prioridade, cobrindo todas as
+// componentes) e calcula as tabelas com 2 * numMarcos execuções de Dijkstra.
+// numMarcos <= 0 usa MARCOS_PADRAO_ALT. Requer pesos não negativos.
+IndiceAlt *criarIndiceAlt(Grafo *grafo, int numMarcos);
+void liberarIndiceAlt(IndiceAlt *indice);
+
+// Distância mínima de origem a destino (DBL_MAX se inalcançável) por A* com parada ao
+// finalizar o destino. Se caminho não for NULL (capacidade numVertices), recebe os
+// vértices do caminho, da origem ao destino, com o tamanho em *tamanhoCaminho.
+double consultarAlt(IndiceAlt *indice, int origem, int destino, int *caminho, int *tamanhoCaminho);
+
+#endif // ALT_H
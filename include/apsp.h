@@ -0,0 +1,31 @@
+#ifndef APSP_H
+#define APSP_H
+
+#include "grafo.h"
+
+// Lado dos blocos do Floyd-Warshall: três blocos de 64 x 64 doubles (96 KiB) ficam na
+// cache enquanto um bloco é atualizado
+#define BLOCO_FLOYD_WARSHALL 64
+
+// Tipo dos valores da matriz de distâncias no arquivo de saída
+typedef enum {
+    APSP_FLOAT32,   // Inalcançável: INFINITY
+    APSP_UINT32     // Distâncias arredondadas e saturadas; inalcançável: UINT32_MAX
+} FormatoApsp;
+
+typedef enum {
+    APSP_AUTOMATICO,      // Floyd-Warshall em grafos densos, Dijkstra nos demais
+    APSP_DIJKSTRA,        // Dijkstra de cada origem (com reajuste de Johnson se houver pesos negativos)
+    APSP_FLOYD_WARSHALL   // Floyd-Warshall em blocos, com a matriz inteira em memória
+} MetodoApsp;
+
+// Caminhos mínimos entre todos os pares, escritos num arquivo mapeado em memória:
+// "GRFP", int32 numVertices, int32 formato, int32 reservado, a matriz n x n por linhas
+// (linha = origem, coluna = destino, em índices internos) em float32 ou uint32, seguida
+// da seção "GRFI" (int64 ids[n]) quando os IDs são esparsos. numThreads < 1 usa uma
+// thread. Retorna 1 em caso de sucesso ou 0 em caso de erro (ciclo negativo, arquivo
+// inválido ou uint32 com pesos negativos).
+int calcularTodosParesCaminhos(Grafo *grafo, const char *nomeArquivo, FormatoApsp formato,
+                               MetodoApsp metodo, int numThreads);
+
+#endif // APSP_H
@@ -0,0 +1,32 @@
+#ifndef ARVORE_BUSCA_H
+#define ARVORE_BUSCA_H
+
+#include "grafo.h"
+
+// Árvore de busca compacta: O(V) de memória, independente da representação do grafo.
+// Como em bfsComFilaArvore, o pai da raiz é a própria raiz; vértices não alcançados têm
+// pai e nível -1. Os filhos de v ficam em filhos[inicioFilhos[v] .. inicioFilhos[v + 1]),
+// na ordem de visita.
+typedef struct {
+    int numVertices;
+    int raiz;
+    int numVisitados;
+    int *pais;
+    int *niveis;
+    int *ordem;             // Vértices na ordem de visita
+    long long *inicioFilhos;
+    int *filhos;
+} ArvoreBusca;
+
+// BFS e DFS (ordem de pilha, como dfsComPilhaArvore) que preenchem a árvore compacta.
+// Se arquivoSaida não for NULL, as linhas "Vértice/Pai/Nível" são escritas como nas
+// funções originais.
+ArvoreBusca *bfsArvoreBusca(Grafo *grafo, int verticeInicial, FILE *arquivoSaida);
+ArvoreBusca *dfsArvoreBusca(Grafo *grafo, int verticeInicial, FILE *arquivoSaida);
+void liberarArvoreBusca(ArvoreBusca *arvore);
+
+// Converte a árvore em um Grafo (arestas não direcionadas filho-pai) somente quando
+// necessário; o resultado é igual à árvore montada pelas funções originais
+Grafo *converterArvoreEmGrafo(ArvoreBusca *arvore, TipoRepresentacao tipo);
+
+#endif // ARVORE_BUSCA_H
@@ -0,0 +1,46 @@
+#ifndef BFS_H
+#define BFS_H
+
+#include "grafo.h"
+
+// Parâmetros da heurística de troca de direção (Beamer et al.)
+#define ALFA_BFS 14
+#define BETA_BFS 24
+
+// BFS com otimização de direção (top-down / bottom-up). Marca visitados e preenche
+// pais/niveis dos vértices alcançados, como bfsComFilaArvore: os níveis são idênticos,
+// mas pais[v] é apenas algum pai válido numa árvore BFS (um vizinho no nível anterior)
+// e só coincide com o de bfsComFilaArvore quando todos os níveis são top-down.
+void bfsDirecaoOtimizada(Grafo *grafo, int verticeInicial, int *visitados, int *pais, int *niveis);
+
+// BFS paralela síncrona por níveis (numThreads threads). Os níveis são os da BFS
+// sequencial e o pai de cada vértice é o vizinho de menor índice no nível anterior,
+// portanto o resultado é determinístico e independe do número de threads.
+void bfsParalela(Grafo *grafo, int verticeInicial, int *visitados, int *pais, int *niveis, int numThreads);
+int calcularDistanciaParalela(Grafo *grafo, int origem, int destino, int numThreads);
+int encontrarCaminhoAumentanteParalelo(Grafo *grafoResidual, int origem, int destino, int *pais, int numThreads);
+
+// Número de palavras de 64 bits por vértice na BFS de múltiplas origens: cada lote
+// executa 64 * PALAVRAS_MSBFS buscas simultâneas (4 palavras = 256 origens, que o
+// compilador vetoriza com SIMD quando disponível)
+#define PALAVRAS_MSBFS 4
+
+// BFS de múltiplas origens com paralelismo de bits (MS-BFS). Preenche distancias, uma
+// matriz numOrigens x numVertices em ordem de linhas: distancias[i * numVertices + v] é a
+// distância de origens[i] até v, ou -1 se v não for alcançável.
+void calcularDistanciasMultiplas(Grafo *grafo, const int *origens, int numOrigens, int *distancias);
+
+// BFS bidirecional: expande por níveis a partir das duas pontas, sempre a fronteira com
+// menos arestas a explorar. Em grafos direcionados a busca reversa usa o CSR das arestas
+// de entrada (construído sob demanda e mantido no Grafo). Retorna -1 se não houver caminho.
+int calcularDistanciaBidirecional(Grafo *grafo, int origem, int destino);
+int calcularDistanciaBidirecionalComEspaco(Grafo *grafo, int origem, int destino, EspacoTrabalho *espaco);
+
+// Caminho aumentante mínimo (em arcos) pela busca bidirecional. Assim como
+// encontrarCaminhoAumentanteComEspaco, pais só é garantido nos vértices do caminho,
+// de destino até origem (pais[origem] = -1).
+int encontrarCaminhoAumentanteBidirecional(Grafo *grafoResidual, int origem, int destino, int *pais);
+int encontrarCaminhoAumentanteBidirecionalComEspaco(Grafo *grafoResidual, int origem, int destino, int *pais,
+                                                     EspacoTrabalho *espaco);
+
+#endif // BFS_H
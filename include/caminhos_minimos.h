@@ -0,0 +1,71 @@
+#ifndef CAMINHOS_MINIMOS_H
+#define CAMINHOS_MINIMOS_H
+
+#include "grafo.h"
+
+// Número máximo de baldes circulares por thread no delta-stepping; deltas menores que
+// pesoMaximo / MAXIMO_BALDES_DELTA são ampliados para respeitar o limite
+#define MAXIMO_BALDES_DELTA (1 << 16)
+
+// Caminhos mínimos por delta-stepping (Meyer e Sanders) com numThreads threads. Cada
+// balde cobre um intervalo de largura delta (delta <= 0 escolhe pesoMaximo / grau médio);
+// as arestas leves (peso <= delta) são relaxadas em fases repetidas até o balde esvaziar
+// e as pesadas uma única vez ao final do balde. Requer pesos não negativos. As distâncias
+// são idênticas às de dijkstraHeap e os pais também, exceto em empates criados por
+// arestas de peso zero, em que o pai é apenas um predecessor válido.
+void dijkstraDeltaStepping(Grafo *grafo, int origem, double delta, int numThreads, int imprimir,
+                           double *distancia, int *pais);
+
+// Bellman-Ford com fila (SPFA) e as heurísticas SLF (vértice com distância menor que a do
+// início da fila entra na frente) e LLL (o início da fila vai para o fim enquanto estiver
+// acima da média). Admite pesos negativos. Retorna 1 em caso de sucesso ou 0 se houver um
+// ciclo negativo alcançável a partir da origem; nesse caso as distâncias não são válidas e,
+// se ciclo não for NULL (capacidade numVertices), recebe os vértices do ciclo na ordem dos
+// arcos, com o tamanho em *tamanhoCiclo.
+int bellmanFordFila(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais,
+                    int *ciclo, int *tamanhoCiclo);
+
+// Potenciais de Johnson: distâncias a partir de uma origem virtual ligada a todos os
+// vértices por arcos de peso 0, calculadas pelo mesmo SPFA. Com eles todo arco (u, v)
+// tem peso reajustado w + h(u) - h(v) >= 0. Retorna 0 (informando o ciclo) se o grafo
+// tiver um ciclo negativo, 1 caso contrário.
+int calcularPotenciaisJohnson(Grafo *grafo, double *potenciais);
+
+// Ordem topológica pelo algoritmo de Kahn em O(V + E). Retorna 1 e preenche ordem
+// (capacidade numVertices) se o grafo for acíclico, 0 se houver ciclo (ordem incompleta).
+int ordenarTopologicamente(Grafo *grafo, int *ordem);
+
+// Caminhos mínimos em um DAG relaxando as arestas na ordem topológica, em O(V + E) e com
+// pesos negativos permitidos. ordem é uma ordem topológica já conhecida ou NULL para
+// calculá-la; retorna 0 (com mensagem de erro) se o grafo tiver ciclo, 1 caso contrário.
+int caminhosMinimosDag(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais, const int *ordem);
+
+// Critérios de parada antecipada do Dijkstra (campos zerados ou NULL não limitam):
+//   alvos/numAlvos: termina quando todos os alvos forem finalizados
+//   raio:           não finaliza vértices a distância maior que raio (<= 0: sem limite)
+//   k:              termina depois de finalizar k alvos, ou k vértices além da origem
+//                   quando não há alvos (k vizinhos mais próximos)
+typedef struct {
+    const int *alvos;
+    int numAlvos;
+    double raio;
+    int k;
+} OpcoesDijkstra;
+
+// Dijkstra com heap que para assim que os critérios de opcoes forem atendidos (opcoes
+// NULL executa até o fim). Só os vértices tocados são inicializados, pelas gerações do
+// espaço de trabalho, então o custo de cada chamada é proporcional à região explorada.
+// Os vértices finalizados são escritos em finalizados (capacidade numVertices) em ordem
+// não decrescente de distância; distancia e pais só são válidos para eles, e o caminho
+// de pais de um vértice finalizado passa apenas por vértices finalizados. Retorna o
+// número de vértices finalizados, ou 0 (com mensagem de erro) se houver pesos negativos.
+int dijkstraLimitado(Grafo *grafo, int origem, const OpcoesDijkstra *opcoes, double *distancia, int *pais,
+                     int *finalizados, EspacoTrabalho *espaco);
+
+// Caminhos mínimos com escolha automática do algoritmo: caminhosMinimosDag quando o grafo
+// é direcionado e acíclico, dijkstraHeap quando todos os pesos são não negativos,
+// bellmanFordFila caso contrário (o ciclo negativo, se houver, é informado com seus
+// vértices). Retorna 0 se houver ciclo negativo, 1 caso contrário.
+int calcularCaminhosMinimos(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais);
+
+#endif // CAMINHOS_MINIMOS_H
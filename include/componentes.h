@@ -0,0 +1,26 @@
+#ifndef COMPONENTES_H
+#define COMPONENTES_H
+
+#include "grafo.h"
+
+// Número de rodadas de vizinhos e de amostras da variante paralela (Afforest)
+#define RODADAS_VIZINHOS_AFFOREST 2
+#define AMOSTRAS_AFFOREST 1024
+
+// Componentes conexas com union-find (união por tamanho e compressão de caminho).
+// As arestas são tratadas como não direcionadas; as componentes são numeradas a partir
+// de 1 na ordem do menor vértice de cada uma, como em descobrirComponentes.
+void descobrirComponentesUnionFind(Grafo *grafo, int *componentes, int *numComponentes);
+void descobrirComponentesParalelo(Grafo *grafo, int *componentes, int *numComponentes, int numThreads);
+
+// Componentes fortemente conexas (arestas direcionadas), numeradas a partir de 1 na
+// ordem do menor vértice de cada uma. A versão sequencial é um Tarjan iterativo (sem
+// recursão); a paralela usa poda de vértices triviais e propagação de cores.
+void componentesFortementeConexas(Grafo *grafo, int *componentes, int *numComponentes);
+void componentesFortementeConexasParalelo(Grafo *grafo, int *componentes, int *numComponentes, int numThreads);
+
+// Grafo de condensação (DAG): um vértice por componente e um arco entre componentes
+// distintas, com capacidade igual à soma das capacidades dos arcos originais
+Grafo *criarGrafoCondensado(Grafo *grafo, const int *componentes, int numComponentes, TipoRepresentacao tipo);
+
+#endif // COMPONENTES_H
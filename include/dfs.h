@@ -0,0 +1,31 @@
+#ifndef DFS_H
+#define DFS_H
+
+#include "grafo.h"
+
+// Classificação das arestas pela DFS
+typedef enum { ARESTA_ARVORE, ARESTA_RETORNO, ARESTA_AVANCO, ARESTA_CRUZAMENTO } TipoAresta;
+
+// Resultado da DFS iterativa. Os tempos usam um único relógio (0 .. 2V-1) para descoberta
+// e finalização; vértices não alcançados têm descoberta = finalizacao = -1 e pai -1.
+// tiposArestas é indexado pela posição da aresta no CSR (obterCSR) do grafo.
+typedef struct {
+    int numVertices;
+    int numVisitados;
+    int *pais;
+    int *niveis;
+    int *descoberta;
+    int *finalizacao;
+    int *ordemFinalizacao;      // Vértices na ordem em que foram finalizados (pós-ordem)
+    unsigned char *tiposArestas;
+} ResultadoDfs;
+
+// DFS sem recursão: cada quadro da pilha contígua guarda o vértice e o cursor do próximo
+// vizinho no CSR, de modo que a ordem de visita é a da DFS recursiva. Com verticeInicial
+// = -1 percorre a floresta inteira (raízes em ordem crescente de índice).
+// Em grafos não direcionados cada aresta aparece nos dois sentidos e as duas cópias
+// recebem a mesma classe (árvore ou retorno).
+ResultadoDfs *dfsIterativa(Grafo *grafo, int verticeInicial);
+void liberarResultadoDfs(ResultadoDfs *resultado);
+
+#endif // DFS_H
@@ -0,0 +1,32 @@
+#ifndef DIAMETRO_H
+#define DIAMETRO_H
+
+#include "grafo.h"
+
+// Limites para o diâmetro e o raio (em número de arestas). A excentricidade de um vértice
+// é a maior distância até os vértices alcançáveis a partir dele, de modo que grafos
+// desconexos têm diâmetro igual ao maior diâmetro entre as componentes. No modo exato os
+// limites inferior e superior coincidem.
+typedef struct {
+    int diametroInferior;
+    int diametroSuperior;
+    int raioInferior;
+    int raioSuperior;
+    int numBuscas; // Número de BFS executadas
+} LimitesDiametro;
+
+// Diâmetro e raio exatos com varredura dupla e poda por limites de excentricidade
+// (Takes e Kosters): cada BFS estreita os limites de todos os vértices da mesma
+// componente (fortemente conexa, em grafos direcionados), e os vértices que não podem
+// alterar o resultado deixam de ser origem. Em geral bastam poucas BFS.
+LimitesDiametro calcularDiametroRaio(Grafo *grafo);
+
+// Modo aproximado: varredura dupla seguida de numAmostras origens aleatórias. Os limites
+// retornados são garantidos (o valor exato está sempre entre inferior e superior).
+LimitesDiametro estimarDiametroRaio(Grafo *grafo, int numAmostras, unsigned long long semente);
+
+// Excentricidade exata de todos os vértices, com a mesma poda por limites
+// (excentricidades deve ter numVertices posições). Retorna o número de BFS executadas.
+int calcularExcentricidades(Grafo *grafo, int *excentricidades);
+
+#endif // DIAMETRO_H
@@ -0,0 +1,15 @@
+#ifndef EXECUCAO_PARALELA_H
+#define EXECUCAO_PARALELA_H
+
+#include <stddef.h>
+
+// Executa funcao(argumentos[t]) em até numThreads threads, sendo a thread 0 a chamadora
+// (argumentos é um vetor com numThreads elementos de tamanhoArgumento bytes). As threads
+// auxiliares só começam a executar depois que todas foram criadas; se a criação de uma
+// delas falhar, o erro é informado e participam apenas as threads 0..k-1 já criadas.
+// Antes da partida, preparar(contexto, k) recebe o número efetivo de threads para
+// inicializar barreiras e o que mais dependa dele (pode ser NULL). Retorna k.
+int executarEmParalelo(int numThreads, void *(*funcao)(void *), void *argumentos, size_t tamanhoArgumento,
+                       void (*preparar)(void *contexto, int numThreads), void *contexto);
+
+#endif // EXECUCAO_PARALELA_H
@@ -0,0 +1,11 @@
+#ifndef GERADOR_H
+#define GERADOR_H
+
+#include "grafo.h"
+
+// Gerador de grafos sintéticos (arestas uniformes com capacidades inteiras em [1, capacidadeMaxima])
+Grafo *gerarGrafoSintetico(int numVertices, long long numArestas, int capacidadeMaxima,
+                           unsigned long long semente, TipoRepresentacao tipo, int direcionado);
+unsigned long long proximoAleatorio(unsigned long long *estado);
+
+#endif // GERADOR_H
@@ -3,29 +3,38 @@
 
 #include "grafo_matriz.h"
 #include "grafo_lista.h"
+#include "saida.h"
+#include "mapa_vertices.h"
+#include "grafo_csr.h"
+#include "heap_indexado.h"
 #include <stdio.h>
 #include <float.h>
 
 typedef enum { MATRIZ_ADJACENCIA, LISTA_ADJACENCIA } TipoRepresentacao;
 
+// Contagens de arestas usam 64 bits; os vértices mantêm índices de 32 bits
 typedef struct {
     TipoRepresentacao tipo;
     int numVertices;
-    int numArestas;
+    long long numArestas;
     int direcionado;
     GrafoMatriz *grafoMatriz;
     GrafoLista *grafoLista;
+    MapaVertices *mapaIds; // NULL quando os IDs são densos (1..N)
+    GrafoCSR *csr;         // Cache CSR (construído sob demanda, invalidado ao inserir arestas)
+    GrafoCSR *csrReverso;  // Cache CSR das arestas de entrada
 } Grafo;
 
 typedef struct {
     int numVertices;
-    int numArestas;
+    long long numArestas;
     int grauMinimo;
     int grauMaximo;
     float grauMedio;
     int medianaGrau;
 } EstatisticasGrafo;
 
+// Pilha e fila guardam vértices, portanto a capacidade é limitada por numVertices
 typedef struct {
     int *dados;
     int topo;
@@ -51,13 +60,35 @@ typedef struct {
     HeapNode **array;
 } MinHeap;
 
+// Espaço de trabalho reutilizável pelas buscas (um por thread). Um vértice está marcado
+// quando marcas[v] == geracao; cada busca incrementa a geração em vez de limpar o vetor,
+// e os demais vetores só são válidos para os vértices marcados na busca atual. O heap e
+// os sucessores só são alocados na primeira busca que os pede (obterHeapEspaco e
+// obterSucessoresEspaco), então as BFS simples pagam apenas marcas, fila e distâncias.
+typedef struct {
+    int capacidade;
+    unsigned int geracao;
+    unsigned int *marcas;
+    int *fila;
+    int *distancias;
+    int *sucessores;      // Sucessor no caminho até o destino (busca bidirecional); NULL até o primeiro uso
+    HeapIndexado *heap;   // NULL até o primeiro uso
+} EspacoTrabalho;
+
 // Funções principais do grafo
 Grafo *criarGrafo(int numVertices, TipoRepresentacao tipo, int direcionado);
 Grafo *criarGrafoVazio(int numVertices, TipoRepresentacao tipo);
 void liberarGrafo(Grafo *grafo);
 EstatisticasGrafo *calcularEstatisticasGrafo(Grafo *grafo);
-void lerArestas(Grafo *grafo, const char *nomeArquivo, int direcionado);
+long long lerArestas(Grafo *grafo, const char *nomeArquivo, int direcionado);
 void adicionarArestaGrafo(Grafo *grafo, int u, int v, double capacidade, int direcionado);
+long long rotuloVertice(Grafo *grafo, int vertice);
+
+// Funções de acesso à representação CSR em cache
+GrafoCSR *obterCSR(Grafo *grafo);
+GrafoCSR *obterCSRReverso(Grafo *grafo);
+void invalidarCSR(Grafo *grafo);
+const long long *obterIdsExternos(Grafo *grafo);
 
 // Funções auxiliares
 int compararInteiros(const void *p, const void *arg);
@@ -76,15 +107,28 @@ int dequeue(Fila *fila);
 int estaVaziaFila(Fila *fila);
 void liberarFila(Fila *fila);
 
-// Funções DFS e BFS
-void dfsComPilhaArvore(Grafo *grafo, int verticeInicial, int *visitados, Grafo *arvoreDFS, int *pais, int *niveis, FILE *arquivoSaida);
-void bfsComFilaArvore(Grafo *grafo, int verticeInicial, int *visitados, Grafo *arvoreBFS, int *pais, int *niveis, FILE *arquivoSaida);
+// Funções do espaço de trabalho
+EspacoTrabalho *criarEspacoTrabalho(int numVertices);
+void iniciarBuscaEspaco(EspacoTrabalho *espaco, int numVertices);
+void liberarEspacoTrabalho(EspacoTrabalho *espaco);
+HeapIndexado *obterHeapEspaco(EspacoTrabalho *espaco);
+int *obterSucessoresEspaco(EspacoTrabalho *espaco);
+
+// Funções DFS e BFS. Com SAIDA_TEXTO, arquivoSaida recebe uma linha por vértice na ordem
+// de visita; com SAIDA_BINARIA, a árvore no formato "GRFA" ao final da busca, só com os
+// vértices visitados nesta chamada (os demais, inclusive os marcados antes em visitados, com -1).
+void dfsComPilhaArvore(Grafo *grafo, int verticeInicial, int *visitados, Grafo *arvoreDFS, int *pais, int *niveis,
+                       FILE *arquivoSaida, FormatoSaida formato);
+void bfsComFilaArvore(Grafo *grafo, int verticeInicial, int *visitados, Grafo *arvoreBFS, int *pais, int *niveis,
+                      FILE *arquivoSaida, FormatoSaida formato);
 int calcularDistancia(Grafo *grafo, int origem, int destino);
+int calcularDistanciaComEspaco(Grafo *grafo, int origem, int destino, EspacoTrabalho *espaco);
 void descobrirComponentes(Grafo *grafo, int *componentes, int *numComponentes);
 
 // Funções de Dijkstra
 int possuiPesosNegativos(Grafo *grafo);
 void dijkstraVetor(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais);
+void dijkstraVetorComEspaco(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais, EspacoTrabalho *espaco);
 
 // Protótipos das funções do Heap
 MinHeap* criarMinHeap(int capacidade);
@@ -96,13 +140,23 @@ int estaNoHeap(MinHeap *minHeap, int vertice);
 int estaVazioHeap(MinHeap *minHeap);
 void liberarMinHeap(MinHeap *minHeap);
 
-// Protótipo da função Dijkstra com Heap
+// Protótipo da função Dijkstra com Heap. Com pesos inteiros positivos até LIMITE_PESO_DIAL
+// a fila de prioridade passa a ser a de baldes circulares de Dial (mesmas distâncias e pais).
+// Com pesos negativos (verificados uma vez e guardados no CSR) a chamada é encaminhada ao
+// bellmanFordFila, que informa um ciclo negativo alcançável em vez de distâncias erradas.
+#define LIMITE_PESO_DIAL 65536
 void dijkstraHeap(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais);
+void dijkstraHeapComEspaco(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais, EspacoTrabalho *espaco);
+void dijkstraHeapIndexadoComEspaco(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais,
+                                   EspacoTrabalho *espaco);
+void dijkstraCSRComEspaco(GrafoCSR *csr, int origem, double *distancia, int *pais, EspacoTrabalho *espaco);
 
 // Funções para o algoritmo de Ford-Fulkerson
 Grafo *criarGrafoResidual(Grafo *grafoOriginal);
 void adicionarArestaResidual(Grafo *grafo, int u, int v, double capacidade, int original);
 int encontrarCaminhoAumentante(Grafo *grafoResidual, int origem, int destino, int *pais);
+// Variante sem inicialização O(V): pais só é válido para os vértices marcados no espaço
+int encontrarCaminhoAumentanteComEspaco(Grafo *grafoResidual, int origem, int destino, int *pais, EspacoTrabalho *espaco);
 double calcularGargalo(Grafo *grafoResidual, int origem, int destino, int *pais);
 void atualizarFluxos(Grafo *grafoOriginal, Grafo *grafoResidual, int origem, int destino, int *pais, double gargalo);
 double fordFulkerson(Grafo *grafoOriginal, int origem, int destino);
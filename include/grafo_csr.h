@@ -0,0 +1,30 @@
+#ifndef GRAFO_CSR_H
+#define GRAFO_CSR_H
+
+// Representação compacta (CSR) somente leitura, usada pelos algoritmos de busca.
+// Os vizinhos de u estão em destinos[inicio[u] .. inicio[u + 1] - 1].
+typedef struct {
+    int numVertices;
+    long long numArestas;
+    long long *inicio;
+    int *destinos;
+    double *pesos;
+    long long pesoInteiroMaximo; // Cache de obterPesoInteiroMaximo
+    int pesosNegativos;          // Cache de obterPesosNegativos
+} GrafoCSR;
+
+// Valor do cache enquanto os pesos ainda não foram examinados
+#define PESO_NAO_CALCULADO (-2)
+
+// Funções para manipulação do grafo CSR
+GrafoCSR *criarGrafoCSR(int numVertices, long long numArestas);
+void liberarGrafoCSR(GrafoCSR *csr);
+GrafoCSR *transporGrafoCSR(const GrafoCSR *csr);
+
+// Maior peso se todos os pesos forem inteiros positivos (exatos em double), ou -1
+long long obterPesoInteiroMaximo(GrafoCSR *csr);
+
+// 1 se algum peso for negativo, 0 caso contrário (calculado uma vez e guardado)
+int obterPesosNegativos(GrafoCSR *csr);
+
+#endif // GRAFO_CSR_H
@@ -0,0 +1,99 @@
+#ifndef HEAP_INDEXADO_H
+#define HEAP_INDEXADO_H
+
+// Aridade do heap: 4 filhos por nó deixam a árvore mais rasa e os filhos de um nó
+// cabem na mesma linha de cache
+#define ARIDADE_HEAP 4
+
+// Par chave/vértice guardado por valor
+typedef struct {
+    double chave;
+    int vertice;
+} ItemHeap;
+
+// Heap d-ário indexado com os itens em um único vetor. posicoes[v] é a posição de v no
+// heap e só é válida enquanto v estiver nele (o chamador controla quais vértices foram
+// inseridos, por exemplo com as marcas do espaço de trabalho). Chaves iguais são
+// desempatadas pelo menor vértice, de modo que a ordem de extração é determinística.
+typedef struct {
+    int tamanho;
+    int capacidade;
+    ItemHeap *itens;
+    int *posicoes;
+} HeapIndexado;
+
+HeapIndexado *criarHeapIndexado(int capacidade);
+void liberarHeapIndexado(HeapIndexado *heap);
+
+static inline int precedeItemHeap(ItemHeap a, ItemHeap b) {
+    return a.chave < b.chave || (a.chave == b.chave && a.vertice < b.vertice);
+}
+
+// Sobe o item da posição i (deslocando os pais em vez de trocar pares)
+static inline void subirHeapIndexado(HeapIndexado *heap, int i) {
+    ItemHeap item = heap->itens[i];
+    while (i > 0) {
+        int pai = (i - 1) / ARIDADE_HEAP;
+        if (!precedeItemHeap(item, heap->itens[pai])) {
+            break;
+        }
+        heap->itens[i] = heap->itens[pai];
+        heap->posicoes[heap->itens[i].vertice] = i;
+        i = pai;
+    }
+    heap->itens[i] = item;
+    heap->posicoes[item.vertice] = i;
+}
+
+// Desce o item da posição i até o lugar correto
+static inline void descerHeapIndexado(HeapIndexado *heap, int i) {
+    ItemHeap item = heap->itens[i];
+    while (1) {
+        int primeiro = ARIDADE_HEAP * i + 1;
+        if (primeiro >= heap->tamanho) {
+            break;
+        }
+        int ultimo = primeiro + ARIDADE_HEAP < heap->tamanho ? primeiro + ARIDADE_HEAP : heap->tamanho;
+        int menor = primeiro;
+        for (int filho = primeiro + 1; filho < ultimo; filho++) {
+            if (precedeItemHeap(heap->itens[filho], heap->itens[menor])) {
+                menor = filho;
+            }
+        }
+        if (!precedeItemHeap(heap->itens[menor], item)) {
+            break;
+        }
+        heap->itens[i] = heap->itens[menor];
+        heap->posicoes[heap->itens[i].vertice] = i;
+        i = menor;
+    }
+    heap->itens[i] = item;
+    heap->posicoes[item.vertice] = i;
+}
+
+static inline void inserirHeapIndexado(HeapIndexado *heap, int vertice, double chave) {
+    int i = heap->tamanho++;
+    heap->itens[i].chave = chave;
+    heap->itens[i].vertice = vertice;
+    subirHeapIndexado(heap, i);
+}
+
+static inline void diminuirChaveHeapIndexado(HeapIndexado *heap, int vertice, double chave) {
+    int i = heap->posicoes[vertice];
+    heap->itens[i].chave = chave;
+    subirHeapIndexado(heap, i);
+}
+
+// Remove o item de menor chave; a posição do vértice removido passa a ser -1
+static inline ItemHeap extrairMinimoHeapIndexado(HeapIndexado *heap) {
+    ItemHeap minimo = heap->itens[0];
+    heap->posicoes[minimo.vertice] = -1;
+    heap->tamanho--;
+    if (heap->tamanho > 0) {
+        heap->itens[0] = heap->itens[heap->tamanho];
+        descerHeapIndexado(heap, 0);
+    }
+    return minimo;
+}
+
+#endif // HEAP_INDEXADO_H
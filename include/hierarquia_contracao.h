@@ -0,0 +1,55 @@
+#ifndef HIERARQUIA_CONTRACAO_H
+#define HIERARQUIA_CONTRACAO_H
+
+#include "grafo.h"
+
+// Máximo de vértices finalizados por busca de testemunhas durante a contração. Buscas
+// interrompidas só acrescentam atalhos desnecessários, nunca distâncias erradas.
+#define LIMITE_BUSCA_TESTEMUNHA 500
+
+// Hierarquia de contração (Geisberger et al.). Os vértices são contraídos em ordem de
+// nível; cada arco guardado liga um vértice a outro de nível maior:
+//   subida[u]:  arcos u -> x da hierarquia, com nivel[x] > nivel[u]
+//   descida[u]: arcos x -> u da hierarquia, com nivel[x] > nivel[u] (guardados em u, com
+//               destino x, para a busca reversa a partir do destino)
+// meios[e] é o vértice contraído que o atalho e substitui, ou -1 para arcos originais.
+// A hierarquia é independente do grafo de origem depois de construída.
+typedef struct {
+    int numVertices;
+    int *nivel;
+    long long *idsExternos;    // NULL quando os IDs são densos (1..N)
+    GrafoCSR *subida;
+    GrafoCSR *descida;
+    int *meiosSubida;
+    int *meiosDescida;
+    // Estado das consultas (uma por vez), com marcas por geração
+    EspacoTrabalho *espacoIda;
+    EspacoTrabalho *espacoVolta;
+    double *distanciasIda;
+    double *distanciasVolta;
+    long long *arcosIda;       // Arco de subida usado para chegar a cada vértice
+    long long *arcosVolta;     // Arco de descida usado para chegar a cada vértice
+    int numVisitados;          // Vértices finalizados na última consulta
+} HierarquiaContracao;
+
+// Constrói a hierarquia ordenando os vértices pela diferença de arestas (atalhos
+// inseridos menos arcos removidos, mais o número de vizinhos já contraídos), com
+// atualização preguiçosa das prioridades. Requer pesos não negativos.
+HierarquiaContracao *criarHierarquiaContracao(Grafo *grafo);
+void liberarHierarquiaContracao(HierarquiaContracao *hierarquia);
+
+// Formato binário: "GRFH", int32 numVertices, int32 nivel[n], e para subida e descida
+// int64 numArcos, int64 inicio[n + 1], int32 destinos[m], double pesos[m], int32 meios[m];
+// seguido da seção "GRFI" (int64 ids[n]) quando os IDs são esparsos.
+// Retornam 1/ponteiro em caso de sucesso e 0/NULL em caso de erro.
+int salvarHierarquiaContracao(const HierarquiaContracao *hierarquia, const char *nomeArquivo);
+HierarquiaContracao *carregarHierarquiaContracao(const char *nomeArquivo);
+
+// Distância mínima entre os índices internos origem e destino (DBL_MAX se inalcançável)
+// por busca bidirecional só por arcos de subida. Se caminho não for NULL (capacidade
+// numVertices), recebe o caminho desempacotado, da origem ao destino, com os IDs
+// originais dos vértices, e *tamanhoCaminho o seu tamanho.
+double consultarHierarquiaContracao(HierarquiaContracao *hierarquia, int origem, int destino,
+                                    long long *caminho, int *tamanhoCaminho);
+
+#endif // HIERARQUIA_CONTRACAO_H
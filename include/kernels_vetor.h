@@ -0,0 +1,27 @@
+#ifndef KERNELS_VETOR_H
+#define KERNELS_VETOR_H
+
+// Conjunto de instruções usado pelos laços do Dijkstra com vetor. Os kernels vetoriais
+// são compilados com __attribute__((target)) e escolhidos em tempo de execução, então o
+// binário continua rodando em CPUs sem AVX.
+typedef enum {
+    KERNEL_ESCALAR,
+    KERNEL_AVX2,
+    KERNEL_AVX512
+} NivelKernelVetor;
+
+// Maior nível suportado pela CPU atual (KERNEL_ESCALAR fora de x86)
+NivelKernelVetor detectarKernelVetor(void);
+
+// Vértice não visitado (marcas[v] != geracao) de menor distância, com o menor índice em
+// caso de empate, ou -1 se todos os restantes tiverem distância DBL_MAX. Todos os níveis
+// devolvem o mesmo vértice que a varredura escalar.
+int encontrarMinimoNaoVisitado(NivelKernelVetor nivel, const double *distancia, const unsigned int *marcas,
+                               unsigned int geracao, int numVertices);
+
+// Relaxa a linha u da matriz: para cada v não visitado com pesos[v] > 0 e
+// distancia[u] + pesos[v] < distancia[v], atualiza distancia[v] e pais[v] = u.
+void relaxarLinhaMatriz(NivelKernelVetor nivel, const double *pesos, int u, double *distancia, int *pais,
+                        const unsigned int *marcas, unsigned int geracao, int numVertices);
+
+#endif // KERNELS_VETOR_H
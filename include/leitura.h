@@ -0,0 +1,33 @@
+#ifndef LEITURA_H
+#define LEITURA_H
+
+#include "grafo.h"
+
+// Buffer de arestas lidas do arquivo, antes da construção do grafo
+typedef struct {
+    int *origens;
+    int *destinos;
+    double *capacidades;
+    long long numArestas;
+    long long capacidade;
+} BufferArestas;
+
+// Funções para manipulação do buffer de arestas
+BufferArestas *criarBufferArestas(long long capacidadeInicial);
+void inserirArestaBuffer(BufferArestas *buffer, int u, int v, double capacidade);
+void liberarBufferArestas(BufferArestas *buffer);
+Grafo *construirGrafoDeArestas(BufferArestas *buffer, int numVertices, TipoRepresentacao tipo, int direcionado);
+
+// Remove laços e funde arestas paralelas; retorna o número de arestas removidas
+long long normalizarArestas(BufferArestas *buffer, int numVertices, int direcionado);
+
+// Leitura de arquivos com IDs de vértices esparsos (64 bits)
+Grafo *lerGrafoIdsEsparsos(const char *nomeArquivo, TipoRepresentacao tipo, int direcionado,
+                           long long *arestasRemovidas);
+
+// Leitura de formatos padrão: DIMACS de fluxo máximo (.max) e Matrix Market coordenado (.mtx)
+Grafo *lerGrafoDimacs(const char *nomeArquivo, TipoRepresentacao tipo, int *origem, int *destino,
+                      long long *arestasRemovidas);
+Grafo *lerGrafoMatrixMarket(const char *nomeArquivo, TipoRepresentacao tipo, long long *arestasRemovidas);
+
+#endif // LEITURA_H
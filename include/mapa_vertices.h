@@ -0,0 +1,20 @@
+#ifndef MAPA_VERTICES_H
+#define MAPA_VERTICES_H
+
+// Tabela hash (endereçamento aberto) de IDs externos de 64 bits para índices internos densos
+typedef struct {
+    long long *chaves;
+    int *valores;          // -1 indica posição livre
+    long long capacidade;  // Sempre potência de 2
+    int tamanho;
+    long long *idsExternos; // Mapeamento reverso: índice interno -> ID externo
+    int capacidadeIds;
+} MapaVertices;
+
+// Funções para manipulação do mapa de vértices
+MapaVertices *criarMapaVertices(int capacidadeInicial);
+void liberarMapaVertices(MapaVertices *mapa);
+int obterOuInserirVertice(MapaVertices *mapa, long long idExterno);
+int buscarVertice(const MapaVertices *mapa, long long idExterno);
+
+#endif // MAPA_VERTICES_H
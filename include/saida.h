@@ -0,0 +1,48 @@
+#ifndef SAIDA_H
+#define SAIDA_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+// Tamanho padrão do buffer de saída (1 MiB)
+#define TAMANHO_BUFFER_SAIDA (1 << 20)
+
+typedef enum { SAIDA_TEXTO, SAIDA_BINARIA } FormatoSaida;
+
+// Valores do parâmetro 'imprimir' das rotinas de caminhos mínimos: 0 não escreve nada,
+// IMPRIMIR_TEXTO escreve as distâncias e os caminhos em texto e IMPRIMIR_BINARIO escreve
+// o formato "GRFD" de escreverDistanciasBinarias, ambos na saída padrão
+#define IMPRIMIR_TEXTO 1
+#define IMPRIMIR_BINARIO 2
+
+typedef struct {
+    FILE *arquivo;
+    char *dados;
+    size_t usado;
+    size_t capacidade;
+} BufferSaida;
+
+// Funções para manipulação do buffer de saída
+BufferSaida *criarBufferSaida(FILE *arquivo, size_t capacidade);
+void descarregarBufferSaida(BufferSaida *buffer);
+void liberarBufferSaida(BufferSaida *buffer);
+
+// Funções de escrita no buffer (inteiros são formatados sem printf)
+void escreverBytes(BufferSaida *buffer, const void *dados, size_t tamanho);
+void escreverTexto(BufferSaida *buffer, const char *texto);
+void escreverInteiro(BufferSaida *buffer, long long valor);
+void escreverReal(BufferSaida *buffer, double valor);
+
+// Funções de saída das árvores de busca e dos caminhos mínimos
+// (idsExternos traduz os índices internos de volta aos IDs do arquivo; NULL para IDs densos 1..N)
+void escreverLinhaArvore(BufferSaida *buffer, long long vertice, long long pai, int nivel);
+void escreverArvoreBinaria(BufferSaida *buffer, const int *pais, const int *niveis, int numVertices,
+                           const long long *idsExternos);
+void escreverDistanciasBinarias(BufferSaida *buffer, int origem, const double *distancia, const int *pais,
+                                int numVertices, const long long *idsExternos);
+void escreverCaminhosMinimos(BufferSaida *buffer, int origem, const double *distancia, const int *pais,
+                             int numVertices, const long long *idsExternos, FormatoSaida formato);
+void imprimirCaminhosMinimos(int imprimir, int origem, const double *distancia, const int *pais, int numVertices,
+                             const long long *idsExternos);
+
+#endif // SAIDA_H
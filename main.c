@@ -2,8 +2,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
-#include "../include/grafo.h"
 #include "include/grafo.h"
+#include "include/leitura.h"
 
 #define MAX_NOME_ARQUIVO_SAIDA 256
 #define SUFIXO_ESTUDO_CASO "-estudoCaso4.txt"
@@ -11,15 +11,22 @@
 
 int main(int argc, char *argv[]) {
     if (argc < 3) {
-        printf("Uso: %s <arquivo_entrada> <tipo_representacao>\n", argv[0]);
+        printf("Uso: %s <arquivo_entrada> <tipo_representacao> [esparso]\n", argv[0]);
         printf("Tipos de representação:\n");
         printf("1 - Lista de Adjacência\n");
         printf("2 - Matriz de Adjacência\n");
+        printf("esparso - IDs de vértices arbitrários de 64 bits (remapeados na leitura)\n");
+        printf("Arquivos .max (DIMACS) e .mtx (Matrix Market) são detectados pela extensão;\n");
+        printf("no formato DIMACS a fonte e o sumidouro vêm do próprio arquivo.\n");
         return 1;
     }
 
     const char *nomeArquivoEntrada = argv[1];
     int tipoRepresentacao = atoi(argv[2]);
+    int idsEsparsos = argc > 3 && strcmp(argv[3], "esparso") == 0;
+    const char *extensao = strrchr(nomeArquivoEntrada, '.');
+    int formatoDimacs = extensao != NULL && strcmp(extensao, ".max") == 0;
+    int formatoMatrixMarket = extensao != NULL && strcmp(extensao, ".mtx") == 0;
 
     TipoRepresentacao tipo;
     if (tipoRepresentacao == 1) {
@@ -46,38 +53,81 @@ int main(int argc, char *argv[]) {
         *ponto = '\0';
     }
 
-    // Lê o grafo do arquivo
-    FILE *arquivo = fopen(nomeArquivoEntrada, "r");
-    if (!arquivo) {
-        printf("Erro ao abrir o arquivo %s.\n", nomeArquivoEntrada);
-        return 1;
-    }
-
+    Grafo *grafo = NULL;
     int numVertices;
-    if (fscanf(arquivo, "%d", &numVertices) != 1) {
-        printf("Erro ao ler o número de vértices do arquivo %s.\n", nomeArquivoEntrada);
-        fclose(arquivo);
-        return 1;
-    }
+    int origem = 0;  // Vértice 1
+    int destino = 1; // Vértice 2
+    long long arestasRemovidas = 0;
+
+    if (formatoDimacs) {
+        // A fonte e o sumidouro do arquivo substituem os vértices 1 e 2
+        grafo = lerGrafoDimacs(nomeArquivoEntrada, tipo, &origem, &destino, &arestasRemovidas);
+        if (!grafo) {
+            return 1;
+        }
+        numVertices = grafo->numVertices;
+        if (origem == -1 || destino == -1) {
+            printf("Erro: fonte ou sumidouro ausente no arquivo %s.\n", nomeArquivoEntrada);
+            liberarGrafo(grafo);
+            return 1;
+        }
+    } else if (formatoMatrixMarket) {
+        grafo = lerGrafoMatrixMarket(nomeArquivoEntrada, tipo, &arestasRemovidas);
+        if (!grafo) {
+            return 1;
+        }
+        numVertices = grafo->numVertices;
+    } else if (idsEsparsos) {
+        // Lê o grafo direcionado remapeando os IDs para índices densos
+        grafo = lerGrafoIdsEsparsos(nomeArquivoEntrada, tipo, 1, &arestasRemovidas);
+        if (!grafo) {
+            return 1;
+        }
+        numVertices = grafo->numVertices;
+        origem = buscarVertice(grafo->mapaIds, 1);
+        destino = buscarVertice(grafo->mapaIds, 2);
+        if (origem == -1 || destino == -1) {
+            printf("Erro: os vértices 1 e 2 não aparecem no arquivo %s.\n", nomeArquivoEntrada);
+            liberarGrafo(grafo);
+            return 1;
+        }
+    } else {
+        // Lê o grafo do arquivo
+        FILE *arquivo = fopen(nomeArquivoEntrada, "r");
+        if (!arquivo) {
+            printf("Erro ao abrir o arquivo %s.\n", nomeArquivoEntrada);
+            return 1;
+        }
 
-    if (numVertices <= 0) {
-        printf("Erro: Número de vértices inválido (%d) lido do arquivo %s.\n", numVertices, nomeArquivoEntrada);
-        fclose(arquivo);
-        return 1;
-    }
+        if (fscanf(arquivo, "%d", &numVertices) != 1) {
+            printf("Erro ao ler o número de vértices do arquivo %s.\n", nomeArquivoEntrada);
+            fclose(arquivo);
+            return 1;
+        }
+
+        if (numVertices <= 0) {
+            printf("Erro: Número de vértices inválido (%d) lido do arquivo %s.\n", numVertices, nomeArquivoEntrada);
+            fclose(arquivo);
+            return 1;
+        }
+
+        // Cria o grafo direcionado
+        grafo = criarGrafo(numVertices, tipo, 1); // '1' indica grafo direcionado
+        if (!grafo) {
+            printf("Erro ao criar o grafo com %d vértices.\n", numVertices);
+            fclose(arquivo);
+            return 1;
+        }
+
+        // Lê as arestas do arquivo
+        arestasRemovidas = lerArestas(grafo, nomeArquivoEntrada, 1); // '1' indica grafo direcionado
 
-    // Cria o grafo direcionado
-    Grafo *grafo = criarGrafo(numVertices, tipo, 1); // '1' indica grafo direcionado
-    if (!grafo) {
-        printf("Erro ao criar o grafo com %d vértices.\n", numVertices);
         fclose(arquivo);
-        return 1;
     }
 
-    // Lê as arestas do arquivo
-    lerArestas(grafo, nomeArquivoEntrada, 1); // '1' indica grafo direcionado
-
-    fclose(arquivo);
+    if (arestasRemovidas > 0) {
+        printf("Arestas removidas na normalização (laços e paralelas): %lld\n", arestasRemovidas);
+    }
 
     // Executa o estudo de caso
     int numExecucoes = 10;
@@ -107,7 +157,7 @@ int main(int argc, char *argv[]) {
         }
 
         clock_t inicio = clock();
-        double fluxo = fordFulkerson(grafoCopia, 0, 1); // Vértices 1 e 2 (índices 0 e 1)
+        double fluxo = fordFulkerson(grafoCopia, origem, destino);
         clock_t fim = clock();
 
         double tempoExecucao = ((double)(fim - inicio)) / CLOCKS_PER_SEC * 1000.0; // Tempo em ms
@@ -119,7 +169,10 @@ int main(int argc, char *argv[]) {
 
     double tempoMedio = tempoTotal / numExecucoes;
 
-    printf("Fluxo máximo entre os vértices 1 e 2: %.2f\n", fluxoMaximo);
+    long long rotuloOrigem = rotuloVertice(grafo, origem);
+    long long rotuloDestino = rotuloVertice(grafo, destino);
+
+    printf("Fluxo máximo entre os vértices %lld e %lld: %.2f\n", rotuloOrigem, rotuloDestino, fluxoMaximo);
     printf("Tempo médio de execução do algoritmo: %.6f ms\n", tempoMedio);
 
     // Gera o nome do arquivo de saída, seguindo o padrão dos outros estudos de caso
@@ -130,7 +183,7 @@ int main(int argc, char *argv[]) {
     if (!arquivoSaida) {
         printf("Erro ao criar o arquivo %s.\n", nomeArquivoSaida);
     } else {
-        fprintf(arquivoSaida, "Fluxo máximo entre os vértices 1 e 2: %.2f\n", fluxoMaximo);
+        fprintf(arquivoSaida, "Fluxo máximo entre os vértices %lld e %lld: %.2f\n", rotuloOrigem, rotuloDestino, fluxoMaximo);
         fprintf(arquivoSaida, "Tempo médio de execução do algoritmo: %.6f ms\n", tempoMedio);
         fclose(arquivoSaida);
         printf("Resultados do estudo de caso salvos em %s\n", nomeArquivoSaida);
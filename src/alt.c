@@ -0,0 +1,256 @@
+#include "../include/alt.h"
+#include "../include/heap_indexado.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <float.h>
+
+// Vértice ainda não escolhido como marco mais distante dos marcos atuais (menor índice
+// em caso de empate). Distância DBL_MAX significa não alcançado por nenhum marco.
+static int escolherMarcoMaisDistante(const double *minimo, const char *escolhido, int numVertices) {
+    int melhor = -1;
+    for (int v = 0; v < numVertices; v++) {
+        if (!escolhido[v] && (melhor == -1 || minimo[v] > minimo[melhor])) {
+            melhor = v;
+        }
+    }
+    return melhor;
+}
+
+IndiceAlt *criarIndiceAlt(Grafo *grafo, int numMarcos) {
+    GrafoCSR *csr = obterCSR(grafo);
+    GrafoCSR *reverso = grafo->direcionado ? obterCSRReverso(grafo) : csr;
+    int n = csr->numVertices;
+    if (numMarcos <= 0) {
+        numMarcos = MARCOS_PADRAO_ALT;
+    }
+    if (numMarcos > n) {
+        numMarcos = n;
+    }
+
+    IndiceAlt *indice = (IndiceAlt *)malloc(sizeof(IndiceAlt));
+    if (!indice) {
+        fprintf(stderr, "Erro ao alocar memória para o índice ALT\n");
+        exit(EXIT_FAILURE);
+    }
+    size_t tamanhoTabela = (size_t)n * (size_t)numMarcos;
+    indice->numVertices = n;
+    indice->numMarcos = numMarcos;
+    indice->csr = csr;
+    indice->marcos = (int *)malloc((size_t)(numMarcos > 0 ? numMarcos : 1) * sizeof(int));
+    indice->distanciasDe = (double *)malloc((tamanhoTabela > 0 ? tamanhoTabela : 1) * sizeof(double));
+    indice->distanciasPara = grafo->direcionado
+                                 ? (double *)malloc((tamanhoTabela > 0 ? tamanhoTabela : 1) * sizeof(double))
+                                 : indice->distanciasDe;
+    indice->espaco = criarEspacoTrabalho(n);
+    indice->custos = (double *)malloc((size_t)n * sizeof(double));
+    indice->estimativas = (double *)malloc((size_t)n * sizeof(double));
+    indice->pais = (int *)malloc((size_t)n * sizeof(int));
+    indice->numAtivos = 0;
+    indice->numVisitados = 0;
+
+    double *distancia = (double *)malloc((size_t)n * sizeof(double));
+    double *minimo = (double *)malloc((size_t)n * sizeof(double));
+    char *escolhido = (char *)calloc((size_t)n, sizeof(char));
+    if (!indice->marcos || !indice->distanciasDe || !indice->distanciasPara || !indice->custos ||
+        !indice->estimativas || !indice->pais || !distancia || !minimo || !escolhido) {
+        fprintf(stderr, "Erro ao alocar memória para o índice ALT\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // A primeira busca parte do vértice 0 apenas para escolher o primeiro marco
+    if (n > 0) {
+        dijkstraCSRComEspaco(csr, 0, minimo, indice->pais, indice->espaco);
+    }
+    for (int i = 0; i < numMarcos; i++) {
+        int marco = escolherMarcoMaisDistante(minimo, escolhido, n);
+        if (marco == -1) {
+            break;
+        }
+        indice->marcos[i] = marco;
+        escolhido[marco] = 1;
+
+        dijkstraCSRComEspaco(csr, marco, distancia, indice->pais, indice->espaco);
+        for (int v = 0; v < n; v++) {
+            indice->distanciasDe[(size_t)v * numMarcos + i] = distancia[v];
+            // O mínimo da primeira rodada ainda é o da busca a partir do vértice 0
+            if (i == 0 || distancia[v] < minimo[v]) {
+                minimo[v] = distancia[v];
+            }
+        }
+        if (grafo->direcionado) {
+            dijkstraCSRComEspaco(reverso, marco, distancia, indice->pais, indice->espaco);
+            for (int v = 0; v < n; v++) {
+                indice->distanciasPara[(size_t)v * numMarcos + i] = distancia[v];
+            }
+        }
+    }
+
+    free(distancia);
+    free(minimo);
+    free(escolhido);
+    return indice;
+}
+
+void liberarIndiceAlt(IndiceAlt *indice) {
+    if (indice->distanciasPara != indice->distanciasDe) {
+        free(indice->distanciasPara);
+    }
+    free(indice->distanciasDe);
+    free(indice->marcos);
+    liberarEspacoTrabalho(indice->espaco);
+    free(indice->custos);
+    free(indice->estimativas);
+    free(indice->pais);
+    free(indice);
+}
+
+// Limite inferior de d(v, destino) dado pelo marco i, ou DBL_MAX se o marco prova que o
+// destino é inalcançável a partir de v:
+//   d(v, t) >= d(L, t) - d(L, v)   (se L alcança v mas não t, v não alcança t)
+//   d(v, t) >= d(v, L) - d(t, L)   (se t alcança L mas v não, v não alcança t)
+static inline double limiteMarcoAlt(const IndiceAlt *indice, int i, int v, int destino) {
+    size_t k = (size_t)indice->numMarcos;
+    double deV = indice->distanciasDe[(size_t)v * k + i];
+    double deT = indice->distanciasDe[(size_t)destino * k + i];
+    double paraV = indice->distanciasPara[(size_t)v * k + i];
+    double paraT = indice->distanciasPara[(size_t)destino * k + i];
+    double limite = 0.0;
+
+    if (deV != DBL_MAX) {
+        if (deT == DBL_MAX) {
+            return DBL_MAX;
+        }
+        if (deT - deV > limite) {
+            limite = deT - deV;
+        }
+    }
+    if (paraT != DBL_MAX) {
+        if (paraV == DBL_MAX) {
+            return DBL_MAX;
+        }
+        if (paraV - paraT > limite) {
+            limite = paraV - paraT;
+        }
+    }
+    return limite;
+}
+
+// Maior limite inferior entre os marcos ativos da consulta
+static inline double estimarDistanciaAlt(const IndiceAlt *indice, int v, int destino) {
+    double estimativa = 0.0;
+    for (int a = 0; a < indice->numAtivos; a++) {
+        double limite = limiteMarcoAlt(indice, indice->ativos[a], v, destino);
+        if (limite > estimativa) {
+            estimativa = limite;
+        }
+    }
+    return estimativa;
+}
+
+// Escolhe os MARCOS_ATIVOS_ALT marcos de maior limite inferior entre origem e destino.
+// Retorna 0 se algum marco já provar que o destino é inalcançável.
+static int selecionarMarcosAtivos(IndiceAlt *indice, int origem, int destino) {
+    double limites[MARCOS_ATIVOS_ALT];
+    indice->numAtivos = 0;
+    for (int i = 0; i < indice->numMarcos; i++) {
+        double limite = limiteMarcoAlt(indice, i, origem, destino);
+        if (limite == DBL_MAX) {
+            return 0;
+        }
+        // Inserção ordenada (decrescente) entre os melhores até agora
+        int pos = indice->numAtivos;
+        if (pos == MARCOS_ATIVOS_ALT) {
+            if (limite <= limites[pos - 1]) {
+                continue;
+            }
+            pos--;
+        } else {
+            indice->numAtivos++;
+        }
+        while (pos > 0 && limites[pos - 1] < limite) {
+            limites[pos] = limites[pos - 1];
+            indice->ativos[pos] = indice->ativos[pos - 1];
+            pos--;
+        }
+        limites[pos] = limite;
+        indice->ativos[pos] = i;
+    }
+    return 1;
+}
+
+double consultarAlt(IndiceAlt *indice, int origem, int destino, int *caminho, int *tamanhoCaminho) {
+    GrafoCSR *csr = indice->csr;
+    EspacoTrabalho *espaco = indice->espaco;
+    double *custos = indice->custos;
+    double *estimativas = indice->estimativas;
+    int *pais = indice->pais;
+
+    indice->numVisitados = 0;
+    if (tamanhoCaminho != NULL) {
+        *tamanhoCaminho = 0;
+    }
+    if (!selecionarMarcosAtivos(indice, origem, destino)) {
+        return DBL_MAX;
+    }
+
+    iniciarBuscaEspaco(espaco, indice->numVertices);
+    unsigned int geracao = espaco->geracao;
+    unsigned int *alcancados = espaco->marcas;
+    HeapIndexado *heap = obterHeapEspaco(espaco);
+    heap->tamanho = 0;
+
+    alcancados[origem] = geracao;
+    custos[origem] = 0.0;
+    estimativas[origem] = estimarDistanciaAlt(indice, origem, destino);
+    pais[origem] = -1;
+    inserirHeapIndexado(heap, origem, estimativas[origem]);
+
+    int encontrado = 0;
+    while (heap->tamanho > 0) {
+        int u = extrairMinimoHeapIndexado(heap).vertice;
+        indice->numVisitados++;
+        if (u == destino) {
+            encontrado = 1;
+            break;
+        }
+
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int v = csr->destinos[e];
+            double novoCusto = custos[u] + csr->pesos[e];
+            if (alcancados[v] != geracao) {
+                alcancados[v] = geracao;
+                estimativas[v] = estimarDistanciaAlt(indice, v, destino);
+                if (estimativas[v] == DBL_MAX) {
+                    heap->posicoes[v] = -1; // Podado: o destino é inalcançável a partir de v
+                    continue;
+                }
+                custos[v] = novoCusto;
+                pais[v] = u;
+                inserirHeapIndexado(heap, v, novoCusto + estimativas[v]);
+            } else if (heap->posicoes[v] >= 0 && novoCusto < custos[v]) {
+                custos[v] = novoCusto;
+                pais[v] = u;
+                diminuirChaveHeapIndexado(heap, v, novoCusto + estimativas[v]);
+            }
+        }
+    }
+
+    if (!encontrado) {
+        return DBL_MAX;
+    }
+    if (caminho != NULL) {
+        int tamanho = 0;
+        for (int v = destino; v != -1; v = pais[v]) {
+            caminho[tamanho++] = v;
+        }
+        for (int i = 0, j = tamanho - 1; i < j; i++, j--) {
+            int temp = caminho[i];
+            caminho[i] = caminho[j];
+            caminho[j] = temp;
+        }
+        if (tamanhoCaminho != NULL) {
+            *tamanhoCaminho = tamanho;
+        }
+    }
+    return custos[destino];
+}
@@ -0,0 +1,383 @@
+#include "../include/apsp.h"
+#include "../include/caminhos_minimos.h"
+#include "../include/execucao_paralela.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <float.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+// Cabeçalhos do formato binário
+#define MAGICO_APSP "GRFP"
+#define MAGICO_IDS "GRFI"
+#define TAMANHO_CABECALHO_APSP 16
+
+// Arquivo de saída mapeado em memória; cada linha da matriz é escrita diretamente no
+// mapeamento, sem passar por buffers de saída
+typedef struct {
+    int descritor;
+    unsigned char *dados;
+    size_t tamanho;
+    unsigned char *matriz;   // Início da matriz, logo após o cabeçalho
+    FormatoApsp formato;
+    int numVertices;
+} SaidaApsp;
+
+static void escreverInteiro32(unsigned char *destino, int32_t valor) {
+    memcpy(destino, &valor, sizeof(valor));
+}
+
+// Cria o arquivo com o tamanho final, mapeia e escreve o cabeçalho e a seção de IDs
+static int abrirSaidaApsp(SaidaApsp *saida, const char *nomeArquivo, int numVertices, FormatoApsp formato,
+                          const long long *idsExternos) {
+    size_t tamanhoMatriz = (size_t)numVertices * (size_t)numVertices * 4;
+    size_t tamanhoIds = idsExternos != NULL ? 4 + (size_t)numVertices * sizeof(long long) : 0;
+    saida->tamanho = TAMANHO_CABECALHO_APSP + tamanhoMatriz + tamanhoIds;
+    saida->formato = formato;
+    saida->numVertices = numVertices;
+
+    saida->descritor = open(nomeArquivo, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (saida->descritor < 0) {
+        printf("Erro ao criar o arquivo %s\n", nomeArquivo);
+        return 0;
+    }
+    if (ftruncate(saida->descritor, (off_t)saida->tamanho) != 0) {
+        printf("Erro ao reservar %zu bytes para o arquivo %s\n", saida->tamanho, nomeArquivo);
+        close(saida->descritor);
+        return 0;
+    }
+    void *dados = mmap(NULL, saida->tamanho, PROT_READ | PROT_WRITE, MAP_SHARED, saida->descritor, 0);
+    if (dados == MAP_FAILED) {
+        printf("Erro ao mapear o arquivo %s em memória\n", nomeArquivo);
+        close(saida->descritor);
+        return 0;
+    }
+    saida->dados = (unsigned char *)dados;
+    saida->matriz = saida->dados + TAMANHO_CABECALHO_APSP;
+
+    memcpy(saida->dados, MAGICO_APSP, 4);
+    escreverInteiro32(saida->dados + 4, numVertices);
+    escreverInteiro32(saida->dados + 8, (int32_t)formato);
+    escreverInteiro32(saida->dados + 12, 0);
+    if (idsExternos != NULL) {
+        unsigned char *secao = saida->matriz + tamanhoMatriz;
+        memcpy(secao, MAGICO_IDS, 4);
+        memcpy(secao + 4, idsExternos, (size_t)numVertices * sizeof(long long));
+    }
+    return 1;
+}
+
+static void fecharSaidaApsp(SaidaApsp *saida) {
+    munmap(saida->dados, saida->tamanho);
+    close(saida->descritor);
+}
+
+// Converte e escreve a linha da origem. Com potenciais de Johnson, as distâncias
+// reajustadas d'(s, t) voltam a d(s, t) = d'(s, t) - h(s) + h(t).
+static void escreverLinhaApsp(SaidaApsp *saida, int origem, const double *distancias, const double *potenciais) {
+    int n = saida->numVertices;
+    size_t base = (size_t)origem * (size_t)n;
+    if (saida->formato == APSP_FLOAT32) {
+        float *linha = (float *)saida->matriz + base;
+        for (int t = 0; t < n; t++) {
+            double d = distancias[t];
+            if (d >= DBL_MAX) {
+                linha[t] = INFINITY;
+                continue;
+            }
+            if (potenciais != NULL) {
+                d += potenciais[t] - potenciais[origem];
+            }
+            linha[t] = (float)d;
+        }
+    } else {
+        // UINT32_MAX fica reservado para inalcançável; o formato só é usado sem pesos
+        // negativos, então não há potenciais nem distâncias negativas
+        uint32_t *linha = (uint32_t *)saida->matriz + base;
+        for (int t = 0; t < n; t++) {
+            double d = distancias[t];
+            if (d >= DBL_MAX) {
+                linha[t] = UINT32_MAX;
+            } else if (d >= (double)(UINT32_MAX - 1)) {
+                linha[t] = UINT32_MAX - 1;
+            } else {
+                linha[t] = (uint32_t)(d + 0.5);
+            }
+        }
+    }
+}
+
+// Cópia do CSR com os pesos reajustados w + h(u) - h(v), não negativos para potenciais
+// válidos (erros de arredondamento abaixo de zero são truncados)
+static GrafoCSR *reajustarPesosJohnson(const GrafoCSR *csr, const double *potenciais) {
+    int n = csr->numVertices;
+    GrafoCSR *reajustado = criarGrafoCSR(n, csr->numArestas);
+    memcpy(reajustado->inicio, csr->inicio, ((size_t)n + 1) * sizeof(long long));
+    memcpy(reajustado->destinos, csr->destinos, (size_t)csr->numArestas * sizeof(int));
+    for (int u = 0; u < n; u++) {
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            double peso = csr->pesos[e] + potenciais[u] - potenciais[csr->destinos[e]];
+            reajustado->pesos[e] = peso > 0.0 ? peso : 0.0;
+        }
+    }
+    return reajustado;
+}
+
+// Estado compartilhado do Dijkstra de todas as origens. As origens são distribuídas por
+// um contador atômico; cada thread tem seu espaço de trabalho e escreve só as suas linhas.
+typedef struct {
+    GrafoCSR *csr;
+    const double *potenciais;   // NULL sem reajuste de Johnson
+    SaidaApsp *saida;
+    atomic_int proximaOrigem;
+} EstadoApspDijkstra;
+
+static void *executarApspDijkstra(void *argumento) {
+    EstadoApspDijkstra *estado = (EstadoApspDijkstra *)argumento;
+    int n = estado->csr->numVertices;
+    EspacoTrabalho *espaco = criarEspacoTrabalho(n);
+    double *distancia = (double *)malloc((size_t)(n > 0 ? n : 1) * sizeof(double));
+    int *pais = (int *)malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    if (!distancia || !pais) {
+        fprintf(stderr, "Erro ao alocar memória para o Dijkstra de todas as origens\n");
+        exit(EXIT_FAILURE);
+    }
+
+    while (1) {
+        int origem = atomic_fetch_add(&estado->proximaOrigem, 1);
+        if (origem >= n) {
+            break;
+        }
+        dijkstraCSRComEspaco(estado->csr, origem, distancia, pais, espaco);
+        escreverLinhaApsp(estado->saida, origem, distancia, estado->potenciais);
+    }
+
+    liberarEspacoTrabalho(espaco);
+    free(distancia);
+    free(pais);
+    return NULL;
+}
+
+static void *executarApspDijkstraThread(void *argumento) {
+    return executarApspDijkstra(*(EstadoApspDijkstra **)argumento);
+}
+
+static void apspDijkstra(GrafoCSR *csr, const double *potenciais, SaidaApsp *saida, int numThreads) {
+    GrafoCSR *reajustado = potenciais != NULL ? reajustarPesosJohnson(csr, potenciais) : NULL;
+    EstadoApspDijkstra estado;
+    estado.csr = reajustado != NULL ? reajustado : csr;
+    estado.potenciais = potenciais;
+    estado.saida = saida;
+    atomic_init(&estado.proximaOrigem, 0);
+
+    // O cache do peso inteiro máximo é preenchido antes de as threads lerem o CSR
+    obterPesoInteiroMaximo(estado.csr);
+
+    // Todas as threads compartilham o mesmo estado; uma criação que falhe só reduz o pool
+    EstadoApspDijkstra **argumentos = (EstadoApspDijkstra **)malloc((size_t)numThreads * sizeof(EstadoApspDijkstra *));
+    if (!argumentos) {
+        fprintf(stderr, "Erro ao alocar memória para as threads\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int t = 0; t < numThreads; t++) {
+        argumentos[t] = &estado;
+    }
+    executarEmParalelo(numThreads, executarApspDijkstraThread, argumentos, sizeof(EstadoApspDijkstra *), NULL, NULL);
+    free(argumentos);
+
+    if (reajustado != NULL) {
+        liberarGrafoCSR(reajustado);
+    }
+}
+
+// Estado do Floyd-Warshall em blocos. Para cada bloco de vértices intermediários bk:
+// o bloco diagonal (bk, bk), depois os demais blocos da linha e da coluna bk, depois
+// todos os outros, cada fase separada por uma barreira. Em cada fase as threads escrevem
+// blocos distintos e só leem blocos que a fase não altera.
+typedef struct {
+    double *distancias;   // Matriz n x n por linhas, INFINITY para inalcançável
+    int numVertices;
+    int numBlocos;
+    int numThreads;
+    pthread_barrier_t barreira;
+} EstadoFloydWarshall;
+
+typedef struct {
+    EstadoFloydWarshall *estado;
+    int id;
+} ArgumentoFloydWarshall;
+
+// linhaI[j] = min(linhaI[j], dik + linhaK[j]) para j em [inicio, fim). As linhas são
+// distintas, e a escrita incondicional (mínimo sem desvio) permite vetorizar o laço.
+static inline void relaxarLinhaFloydWarshall(double *restrict linhaI, const double *restrict linhaK, double dik,
+                                             int inicio, int fim) {
+    for (int j = inicio; j < fim; j++) {
+        double nova = dik + linhaK[j];
+        linhaI[j] = nova < linhaI[j] ? nova : linhaI[j];
+    }
+}
+
+// Relaxa o bloco (bi, bj) pelos vértices intermediários do bloco bk. A linha i == k é
+// pulada: sem ciclos negativos d(k, k) = 0 e ela não muda.
+static void relaxarBlocoFloydWarshall(double *distancias, int n, int bi, int bj, int bk) {
+    int inicioI = bi * BLOCO_FLOYD_WARSHALL, fimI = inicioI + BLOCO_FLOYD_WARSHALL < n ? inicioI + BLOCO_FLOYD_WARSHALL : n;
+    int inicioJ = bj * BLOCO_FLOYD_WARSHALL, fimJ = inicioJ + BLOCO_FLOYD_WARSHALL < n ? inicioJ + BLOCO_FLOYD_WARSHALL : n;
+    int inicioK = bk * BLOCO_FLOYD_WARSHALL, fimK = inicioK + BLOCO_FLOYD_WARSHALL < n ? inicioK + BLOCO_FLOYD_WARSHALL : n;
+    for (int k = inicioK; k < fimK; k++) {
+        const double *linhaK = distancias + (size_t)k * n;
+        for (int i = inicioI; i < fimI; i++) {
+            double *linhaI = distancias + (size_t)i * n;
+            double dik = linhaI[k];
+            if (i != k && dik != INFINITY) {
+                relaxarLinhaFloydWarshall(linhaI, linhaK, dik, inicioJ, fimJ);
+            }
+        }
+    }
+}
+
+static void *executarFloydWarshall(void *argumento) {
+    ArgumentoFloydWarshall *arg = (ArgumentoFloydWarshall *)argumento;
+    EstadoFloydWarshall *estado = arg->estado;
+    int id = arg->id;
+    int n = estado->numVertices;
+    int numBlocos = estado->numBlocos;
+    int numThreads = estado->numThreads;
+    double *distancias = estado->distancias;
+
+    for (int bk = 0; bk < numBlocos; bk++) {
+        if (id == 0) {
+            relaxarBlocoFloydWarshall(distancias, n, bk, bk, bk);
+        }
+        pthread_barrier_wait(&estado->barreira);
+
+        for (int b = id; b < numBlocos; b += numThreads) {
+            if (b != bk) {
+                relaxarBlocoFloydWarshall(distancias, n, bk, b, bk);
+                relaxarBlocoFloydWarshall(distancias, n, b, bk, bk);
+            }
+        }
+        pthread_barrier_wait(&estado->barreira);
+
+        for (int bi = id; bi < numBlocos; bi += numThreads) {
+            if (bi == bk) {
+                continue;
+            }
+            for (int bj = 0; bj < numBlocos; bj++) {
+                if (bj != bk) {
+                    relaxarBlocoFloydWarshall(distancias, n, bi, bj, bk);
+                }
+            }
+        }
+        pthread_barrier_wait(&estado->barreira);
+    }
+    return NULL;
+}
+
+// A divisão dos blocos entre as threads e a barreira usam o número efetivo de threads
+static void prepararFloydWarshall(void *contexto, int numThreads) {
+    EstadoFloydWarshall *estado = (EstadoFloydWarshall *)contexto;
+    estado->numThreads = numThreads;
+    pthread_barrier_init(&estado->barreira, NULL, (unsigned)numThreads);
+}
+
+static void apspFloydWarshall(GrafoCSR *csr, SaidaApsp *saida, int numThreads) {
+    int n = csr->numVertices;
+    double *distancias = (double *)malloc(((size_t)n * (size_t)n > 0 ? (size_t)n * (size_t)n : 1) * sizeof(double));
+    if (!distancias) {
+        fprintf(stderr, "Erro ao alocar memória para a matriz do Floyd-Warshall\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < (size_t)n * (size_t)n; i++) {
+        distancias[i] = INFINITY;
+    }
+    for (int u = 0; u < n; u++) {
+        double *linha = distancias + (size_t)u * n;
+        linha[u] = 0.0;
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int v = csr->destinos[e];
+            if (csr->pesos[e] < linha[v]) {
+                linha[v] = csr->pesos[e];
+            }
+        }
+    }
+
+    EstadoFloydWarshall estado;
+    estado.distancias = distancias;
+    estado.numVertices = n;
+    estado.numBlocos = (n + BLOCO_FLOYD_WARSHALL - 1) / BLOCO_FLOYD_WARSHALL;
+    estado.numThreads = numThreads < estado.numBlocos ? numThreads : (estado.numBlocos > 0 ? estado.numBlocos : 1);
+
+    ArgumentoFloydWarshall *argumentos =
+        (ArgumentoFloydWarshall *)malloc((size_t)estado.numThreads * sizeof(ArgumentoFloydWarshall));
+    if (!argumentos) {
+        fprintf(stderr, "Erro ao alocar memória para as threads\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int t = 0; t < estado.numThreads; t++) {
+        argumentos[t].estado = &estado;
+        argumentos[t].id = t;
+    }
+    executarEmParalelo(estado.numThreads, executarFloydWarshall, argumentos, sizeof(ArgumentoFloydWarshall),
+                       prepararFloydWarshall, &estado);
+    pthread_barrier_destroy(&estado.barreira);
+    free(argumentos);
+
+    for (int u = 0; u < n; u++) {
+        escreverLinhaApsp(saida, u, distancias + (size_t)u * n, NULL);
+    }
+    free(distancias);
+}
+
+int calcularTodosParesCaminhos(Grafo *grafo, const char *nomeArquivo, FormatoApsp formato,
+                               MetodoApsp metodo, int numThreads) {
+    GrafoCSR *csr = obterCSR(grafo);
+    int n = csr->numVertices;
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+
+    // Com pesos negativos os potenciais de Johnson reajustam os pesos para o Dijkstra e
+    // garantem a ausência de ciclos negativos também para o Floyd-Warshall
+    double *potenciais = NULL;
+    if (possuiPesosNegativos(grafo)) {
+        if (formato == APSP_UINT32) {
+            printf("Erro: o formato uint32 não admite arestas de peso negativo.\n");
+            return 0;
+        }
+        potenciais = (double *)malloc((size_t)(n > 0 ? n : 1) * sizeof(double));
+        if (!potenciais) {
+            fprintf(stderr, "Erro ao alocar memória para os potenciais de Johnson\n");
+            exit(EXIT_FAILURE);
+        }
+        if (!calcularPotenciaisJohnson(grafo, potenciais)) {
+            free(potenciais);
+            return 0;
+        }
+    }
+
+    // O Floyd-Warshall faz n^3 relaxações sequenciais na cache; o Dijkstra de todas as
+    // origens custa cerca de n * m * log(n) com acessos dispersos, e perde em grafos densos
+    if (metodo == APSP_AUTOMATICO) {
+        metodo = (double)csr->numArestas * 8.0 >= (double)n * (double)n ? APSP_FLOYD_WARSHALL : APSP_DIJKSTRA;
+    }
+
+    SaidaApsp saida;
+    if (!abrirSaidaApsp(&saida, nomeArquivo, n, formato, obterIdsExternos(grafo))) {
+        free(potenciais);
+        return 0;
+    }
+    if (metodo == APSP_FLOYD_WARSHALL) {
+        apspFloydWarshall(csr, &saida, numThreads);
+    } else {
+        apspDijkstra(csr, potenciais, &saida, numThreads);
+    }
+    fecharSaidaApsp(&saida);
+    free(potenciais);
+    return 1;
+}
@@ -0,0 +1,168 @@
+#include "../include/arvore_busca.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+static ArvoreBusca *criarArvoreBusca(int numVertices, int raiz) {
+    ArvoreBusca *arvore = (ArvoreBusca *)malloc(sizeof(ArvoreBusca));
+    if (!arvore) {
+        fprintf(stderr, "Erro ao alocar memória para a árvore de busca\n");
+        exit(EXIT_FAILURE);
+    }
+    int tamanho = numVertices > 0 ? numVertices : 1;
+    arvore->numVertices = numVertices;
+    arvore->raiz = raiz;
+    arvore->numVisitados = 0;
+    arvore->pais = (int *)malloc((size_t)tamanho * sizeof(int));
+    arvore->niveis = (int *)malloc((size_t)tamanho * sizeof(int));
+    arvore->ordem = (int *)malloc((size_t)tamanho * sizeof(int));
+    arvore->inicioFilhos = (long long *)calloc((size_t)numVertices + 1, sizeof(long long));
+    arvore->filhos = (int *)malloc((size_t)tamanho * sizeof(int));
+    if (!arvore->pais || !arvore->niveis || !arvore->ordem || !arvore->inicioFilhos || !arvore->filhos) {
+        fprintf(stderr, "Erro ao alocar memória para a árvore de busca\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < numVertices; v++) {
+        arvore->pais[v] = -1;
+        arvore->niveis[v] = -1;
+    }
+    return arvore;
+}
+
+void liberarArvoreBusca(ArvoreBusca *arvore) {
+    free(arvore->pais);
+    free(arvore->niveis);
+    free(arvore->ordem);
+    free(arvore->inicioFilhos);
+    free(arvore->filhos);
+    free(arvore);
+}
+
+// Monta o CSR de filhos por contagem, preservando a ordem de visita
+static void construirFilhos(ArvoreBusca *arvore) {
+    long long *inicio = arvore->inicioFilhos;
+    for (int i = 0; i < arvore->numVisitados; i++) {
+        int v = arvore->ordem[i];
+        if (v != arvore->raiz) {
+            inicio[arvore->pais[v] + 1]++;
+        }
+    }
+    for (int v = 0; v < arvore->numVertices; v++) {
+        inicio[v + 1] += inicio[v];
+    }
+    long long *posicao = (long long *)malloc((size_t)(arvore->numVertices > 0 ? arvore->numVertices : 1) *
+                                             sizeof(long long));
+    if (!posicao) {
+        fprintf(stderr, "Erro ao alocar memória para os filhos da árvore\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < arvore->numVertices; v++) {
+        posicao[v] = inicio[v];
+    }
+    for (int i = 0; i < arvore->numVisitados; i++) {
+        int v = arvore->ordem[i];
+        if (v != arvore->raiz) {
+            arvore->filhos[posicao[arvore->pais[v]]++] = v;
+        }
+    }
+    free(posicao);
+}
+
+// Escreve as linhas da árvore na ordem de visita
+static void escreverArvoreBusca(Grafo *grafo, ArvoreBusca *arvore, FILE *arquivoSaida) {
+    BufferSaida *saida = criarBufferSaida(arquivoSaida, TAMANHO_BUFFER_SAIDA);
+    for (int i = 0; i < arvore->numVisitados; i++) {
+        int v = arvore->ordem[i];
+        escreverLinhaArvore(saida, rotuloVertice(grafo, v), rotuloVertice(grafo, arvore->pais[v]), arvore->niveis[v]);
+    }
+    liberarBufferSaida(saida);
+}
+
+// BFS sobre o CSR: o próprio vetor de ordem de visita serve de fila
+ArvoreBusca *bfsArvoreBusca(Grafo *grafo, int verticeInicial, FILE *arquivoSaida) {
+    GrafoCSR *csr = obterCSR(grafo);
+    ArvoreBusca *arvore = criarArvoreBusca(csr->numVertices, verticeInicial);
+    if (verticeInicial < 0 || verticeInicial >= csr->numVertices) {
+        printf("Vértice inicial inválido: %d.\n", verticeInicial + 1);
+        return arvore;
+    }
+
+    int *fila = arvore->ordem;
+    int frente = 0, tras = 0;
+    fila[tras++] = verticeInicial;
+    arvore->pais[verticeInicial] = verticeInicial;
+    arvore->niveis[verticeInicial] = 0;
+
+    while (frente < tras) {
+        int u = fila[frente++];
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int v = csr->destinos[e];
+            if (arvore->niveis[v] == -1) {
+                arvore->pais[v] = u;
+                arvore->niveis[v] = arvore->niveis[u] + 1;
+                fila[tras++] = v;
+            }
+        }
+    }
+    arvore->numVisitados = tras;
+
+    construirFilhos(arvore);
+    if (arquivoSaida != NULL) {
+        escreverArvoreBusca(grafo, arvore, arquivoSaida);
+    }
+    return arvore;
+}
+
+// DFS em ordem de pilha (marca ao empilhar), com a mesma ordem de visita de
+// dfsComPilhaArvore: na matriz os vizinhos são empilhados do maior para o menor índice,
+// na lista na ordem da lista
+ArvoreBusca *dfsArvoreBusca(Grafo *grafo, int verticeInicial, FILE *arquivoSaida) {
+    GrafoCSR *csr = obterCSR(grafo);
+    ArvoreBusca *arvore = criarArvoreBusca(csr->numVertices, verticeInicial);
+    if (verticeInicial < 0 || verticeInicial >= csr->numVertices) {
+        printf("Vértice inicial inválido: %d.\n", verticeInicial + 1);
+        return arvore;
+    }
+
+    int *pilha = (int *)malloc((size_t)csr->numVertices * sizeof(int));
+    if (!pilha) {
+        fprintf(stderr, "Erro ao alocar memória para a pilha da DFS\n");
+        exit(EXIT_FAILURE);
+    }
+    int topo = 0;
+    int ordemInversa = grafo->tipo == MATRIZ_ADJACENCIA;
+    pilha[topo++] = verticeInicial;
+    arvore->pais[verticeInicial] = verticeInicial;
+    arvore->niveis[verticeInicial] = 0;
+
+    while (topo > 0) {
+        int u = pilha[--topo];
+        arvore->ordem[arvore->numVisitados++] = u;
+        long long inicio = csr->inicio[u], fim = csr->inicio[u + 1];
+        for (long long i = 0; i < fim - inicio; i++) {
+            int v = csr->destinos[ordemInversa ? fim - 1 - i : inicio + i];
+            if (arvore->niveis[v] == -1) {
+                arvore->pais[v] = u;
+                arvore->niveis[v] = arvore->niveis[u] + 1;
+                pilha[topo++] = v;
+            }
+        }
+    }
+    free(pilha);
+
+    construirFilhos(arvore);
+    if (arquivoSaida != NULL) {
+        escreverArvoreBusca(grafo, arvore, arquivoSaida);
+    }
+    return arvore;
+}
+
+Grafo *converterArvoreEmGrafo(ArvoreBusca *arvore, TipoRepresentacao tipo) {
+    Grafo *grafo = criarGrafo(arvore->numVertices, tipo, 0);
+    for (int i = 0; i < arvore->numVisitados; i++) {
+        int v = arvore->ordem[i];
+        if (v != arvore->raiz) {
+            adicionarArestaGrafo(grafo, v, arvore->pais[v], 1.0, 0);
+        }
+    }
+    return grafo;
+}
@@ -0,0 +1,642 @@
+#include "../include/bfs.h"
+#include "../include/execucao_paralela.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+// Número de vértices da fronteira retirados de cada vez por uma thread
+#define BLOCO_BFS_PARALELA 64
+
+// Funções auxiliares para mapas de bits
+typedef unsigned long long PalavraBits;
+
+static inline int testarBit(const PalavraBits *bits, int i) {
+    return (int)((bits[i >> 6] >> (i & 63)) & 1ULL);
+}
+
+static inline void marcarBit(PalavraBits *bits, int i) {
+    bits[i >> 6] |= 1ULL << (i & 63);
+}
+
+static PalavraBits *criarMapaBits(int numBits) {
+    PalavraBits *bits = (PalavraBits *)calloc(((size_t)numBits + 63) / 64, sizeof(PalavraBits));
+    if (!bits) {
+        fprintf(stderr, "Erro ao alocar memória para o mapa de bits\n");
+        exit(EXIT_FAILURE);
+    }
+    return bits;
+}
+
+// BFS com otimização de direção. Cada nível é expandido de cima para baixo (percorrendo
+// as arestas de saída da fronteira) ou de baixo para cima (cada vértice não visitado
+// procura um pai na fronteira entre suas arestas de entrada), conforme o número de
+// arestas da fronteira (mf) em relação às arestas ainda não exploradas (mu).
+// Os níveis são idênticos aos de bfsComFilaArvore; os pais formam uma árvore BFS válida
+// e coincidem com os de bfsComFilaArvore quando todos os níveis são top-down.
+void bfsDirecaoOtimizada(Grafo *grafo, int verticeInicial, int *visitados, int *pais, int *niveis) {
+    GrafoCSR *csr = obterCSR(grafo);
+    GrafoCSR *reverso = NULL; // Construído apenas se algum nível for bottom-up
+    int n = csr->numVertices;
+    size_t numPalavras = ((size_t)n + 63) / 64;
+
+    PalavraBits *visitadosBits = criarMapaBits(n);
+    PalavraBits *fronteiraBits = criarMapaBits(n);
+    int *fronteira = (int *)malloc((size_t)n * sizeof(int));
+    int *proxima = (int *)malloc((size_t)n * sizeof(int));
+    if (!fronteira || !proxima) {
+        fprintf(stderr, "Erro ao alocar memória para a BFS\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Arestas ainda não exploradas: soma dos graus dos vértices não visitados
+    long long mu = 0;
+    for (int v = 0; v < n; v++) {
+        if (visitados[v]) {
+            marcarBit(visitadosBits, v);
+        } else {
+            mu += csr->inicio[v + 1] - csr->inicio[v];
+        }
+    }
+
+    visitados[verticeInicial] = 1;
+    marcarBit(visitadosBits, verticeInicial);
+    pais[verticeInicial] = verticeInicial;
+    niveis[verticeInicial] = 0;
+    mu -= csr->inicio[verticeInicial + 1] - csr->inicio[verticeInicial];
+
+    fronteira[0] = verticeInicial;
+    int tamanhoFronteira = 1;
+    long long mf = csr->inicio[verticeInicial + 1] - csr->inicio[verticeInicial];
+    int bottomUp = 0;
+    int nivel = 0;
+
+    while (tamanhoFronteira > 0) {
+        // Escolha da direção do próximo nível
+        if (!bottomUp && mf > mu / ALFA_BFS) {
+            bottomUp = 1;
+        } else if (bottomUp && tamanhoFronteira < n / BETA_BFS) {
+            bottomUp = 0;
+        }
+
+        int tamanhoProxima = 0;
+        long long mfProxima = 0;
+
+        if (!bottomUp) {
+            // Top-down: percorre as arestas de saída da fronteira
+            for (int i = 0; i < tamanhoFronteira; i++) {
+                int u = fronteira[i];
+                for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+                    int v = csr->destinos[e];
+                    if (!testarBit(visitadosBits, v)) {
+                        marcarBit(visitadosBits, v);
+                        visitados[v] = 1;
+                        pais[v] = u;
+                        niveis[v] = nivel + 1;
+                        proxima[tamanhoProxima++] = v;
+                        mfProxima += csr->inicio[v + 1] - csr->inicio[v];
+                    }
+                }
+            }
+        } else {
+            // Bottom-up: cada vértice não visitado procura um pai na fronteira
+            if (reverso == NULL) {
+                reverso = obterCSRReverso(grafo);
+            }
+            memset(fronteiraBits, 0, numPalavras * sizeof(PalavraBits));
+            for (int i = 0; i < tamanhoFronteira; i++) {
+                marcarBit(fronteiraBits, fronteira[i]);
+            }
+            for (int v = 0; v < n; v++) {
+                if (testarBit(visitadosBits, v)) {
+                    continue;
+                }
+                for (long long e = reverso->inicio[v]; e < reverso->inicio[v + 1]; e++) {
+                    int u = reverso->destinos[e];
+                    if (testarBit(fronteiraBits, u)) {
+                        visitados[v] = 1;
+                        pais[v] = u;
+                        niveis[v] = nivel + 1;
+                        proxima[tamanhoProxima++] = v;
+                        mfProxima += csr->inicio[v + 1] - csr->inicio[v];
+                        break;
+                    }
+                }
+            }
+            // Marca depois da varredura para não usar vértices do próprio nível como pais
+            for (int i = 0; i < tamanhoProxima; i++) {
+                marcarBit(visitadosBits, proxima[i]);
+            }
+        }
+
+        mu -= mfProxima;
+        mf = mfProxima;
+
+        int *temp = fronteira;
+        fronteira = proxima;
+        proxima = temp;
+        tamanhoFronteira = tamanhoProxima;
+        nivel++;
+    }
+
+    free(visitadosBits);
+    free(fronteiraBits);
+    free(fronteira);
+    free(proxima);
+}
+
+// Estado compartilhado entre as threads da BFS paralela
+typedef struct {
+    GrafoCSR *csr;
+    atomic_int *niveis;     // -1: não visitado, -2: já visitado antes da busca
+    atomic_int *pais;       // INT_MAX enquanto não houver pai
+    int *fronteira;
+    int *proxima;
+    int tamanhoFronteira;
+    atomic_long proximoIndice;
+    int **locais;           // Fronteiras locais de cada thread
+    int *tamanhosLocais;
+    int *capacidadesLocais;
+    int numThreads;
+    int nivel;
+    int destino;            // Vértice que encerra a busca ao ser alcançado (-1 se nenhum)
+    int terminar;
+    pthread_barrier_t barreira;
+} EstadoBfsParalela;
+
+typedef struct {
+    EstadoBfsParalela *estado;
+    int id;
+} ArgumentoBfsParalela;
+
+// Substitui *alvo por valor se valor for menor
+static inline void minimoAtomico(atomic_int *alvo, int valor) {
+    int atual = atomic_load_explicit(alvo, memory_order_relaxed);
+    while (valor < atual &&
+           !atomic_compare_exchange_weak_explicit(alvo, &atual, valor, memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+static void inserirFronteiraLocal(EstadoBfsParalela *estado, int id, int v) {
+    if (estado->tamanhosLocais[id] == estado->capacidadesLocais[id]) {
+        estado->capacidadesLocais[id] *= 2;
+        estado->locais[id] = (int *)realloc(estado->locais[id], (size_t)estado->capacidadesLocais[id] * sizeof(int));
+        if (!estado->locais[id]) {
+            fprintf(stderr, "Erro ao alocar memória para a fronteira local\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    estado->locais[id][estado->tamanhosLocais[id]++] = v;
+}
+
+static void *executarBfsParalela(void *argumento) {
+    ArgumentoBfsParalela *arg = (ArgumentoBfsParalela *)argumento;
+    EstadoBfsParalela *estado = arg->estado;
+    GrafoCSR *csr = estado->csr;
+    int id = arg->id;
+
+    while (1) {
+        int proximoNivel = estado->nivel + 1;
+        estado->tamanhosLocais[id] = 0;
+
+        // Expansão: blocos da fronteira são distribuídos dinamicamente
+        while (1) {
+            long inicioBloco = atomic_fetch_add(&estado->proximoIndice, BLOCO_BFS_PARALELA);
+            if (inicioBloco >= estado->tamanhoFronteira) {
+                break;
+            }
+            long fimBloco = inicioBloco + BLOCO_BFS_PARALELA;
+            if (fimBloco > estado->tamanhoFronteira) {
+                fimBloco = estado->tamanhoFronteira;
+            }
+            for (long i = inicioBloco; i < fimBloco; i++) {
+                int u = estado->fronteira[i];
+                for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+                    int v = csr->destinos[e];
+                    int nivelV = atomic_load_explicit(&estado->niveis[v], memory_order_relaxed);
+                    if (nivelV == -1) {
+                        // Só uma thread consegue reivindicar o vértice
+                        if (atomic_compare_exchange_strong(&estado->niveis[v], &nivelV, proximoNivel)) {
+                            inserirFronteiraLocal(estado, id, v);
+                            nivelV = proximoNivel;
+                        }
+                    }
+                    // O pai é o vizinho de menor índice no nível anterior
+                    if (nivelV == proximoNivel) {
+                        minimoAtomico(&estado->pais[v], u);
+                    }
+                }
+            }
+        }
+        pthread_barrier_wait(&estado->barreira);
+
+        // Junta as fronteiras locais na próxima fronteira
+        int deslocamento = 0;
+        for (int t = 0; t < id; t++) {
+            deslocamento += estado->tamanhosLocais[t];
+        }
+        memcpy(estado->proxima + deslocamento, estado->locais[id], (size_t)estado->tamanhosLocais[id] * sizeof(int));
+        pthread_barrier_wait(&estado->barreira);
+
+        if (id == 0) {
+            int tamanho = 0;
+            for (int t = 0; t < estado->numThreads; t++) {
+                tamanho += estado->tamanhosLocais[t];
+            }
+            int *temp = estado->fronteira;
+            estado->fronteira = estado->proxima;
+            estado->proxima = temp;
+            estado->tamanhoFronteira = tamanho;
+            estado->nivel++;
+            atomic_store(&estado->proximoIndice, 0);
+            estado->terminar = tamanho == 0 ||
+                               (estado->destino != -1 && atomic_load(&estado->niveis[estado->destino]) >= 0);
+        }
+        pthread_barrier_wait(&estado->barreira);
+
+        if (estado->terminar) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+// Barreira e soma dos tamanhos locais usam o número de threads efetivamente criadas
+static void prepararBfsParalela(void *contexto, int numThreads) {
+    EstadoBfsParalela *estado = (EstadoBfsParalela *)contexto;
+    estado->numThreads = numThreads;
+    pthread_barrier_init(&estado->barreira, NULL, (unsigned)numThreads);
+}
+
+// Executa a BFS paralela; os resultados ficam em estado->niveis/pais
+static void executarBuscaParalela(EstadoBfsParalela *estado, GrafoCSR *csr, const int *visitados,
+                                  int verticeInicial, int destino, int numThreads) {
+    int n = csr->numVertices;
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+
+    estado->csr = csr;
+    estado->niveis = (atomic_int *)malloc((size_t)n * sizeof(atomic_int));
+    estado->pais = (atomic_int *)malloc((size_t)n * sizeof(atomic_int));
+    estado->fronteira = (int *)malloc((size_t)n * sizeof(int));
+    estado->proxima = (int *)malloc((size_t)n * sizeof(int));
+    estado->locais = (int **)malloc((size_t)numThreads * sizeof(int *));
+    estado->tamanhosLocais = (int *)calloc((size_t)numThreads, sizeof(int));
+    estado->capacidadesLocais = (int *)malloc((size_t)numThreads * sizeof(int));
+    if (!estado->niveis || !estado->pais || !estado->fronteira || !estado->proxima ||
+        !estado->locais || !estado->tamanhosLocais || !estado->capacidadesLocais) {
+        fprintf(stderr, "Erro ao alocar memória para a BFS paralela\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int t = 0; t < numThreads; t++) {
+        estado->capacidadesLocais[t] = 1024;
+        estado->locais[t] = (int *)malloc(1024 * sizeof(int));
+        if (!estado->locais[t]) {
+            fprintf(stderr, "Erro ao alocar memória para a BFS paralela\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    for (int v = 0; v < n; v++) {
+        atomic_init(&estado->niveis[v], (visitados != NULL && visitados[v]) ? -2 : -1);
+        atomic_init(&estado->pais[v], INT_MAX);
+    }
+    atomic_store(&estado->niveis[verticeInicial], 0);
+    atomic_store(&estado->pais[verticeInicial], verticeInicial);
+
+    estado->fronteira[0] = verticeInicial;
+    estado->tamanhoFronteira = 1;
+    atomic_init(&estado->proximoIndice, 0);
+    estado->numThreads = numThreads;
+    estado->nivel = 0;
+    estado->destino = destino;
+    estado->terminar = destino == verticeInicial;
+
+    if (!estado->terminar) {
+        ArgumentoBfsParalela *argumentos = (ArgumentoBfsParalela *)malloc((size_t)numThreads * sizeof(ArgumentoBfsParalela));
+        if (!argumentos) {
+            fprintf(stderr, "Erro ao alocar memória para as threads da BFS\n");
+            exit(EXIT_FAILURE);
+        }
+        for (int t = 0; t < numThreads; t++) {
+            argumentos[t].estado = estado;
+            argumentos[t].id = t;
+        }
+        // A thread chamadora também participa como a thread 0
+        executarEmParalelo(numThreads, executarBfsParalela, argumentos, sizeof(ArgumentoBfsParalela),
+                           prepararBfsParalela, estado);
+        pthread_barrier_destroy(&estado->barreira);
+        free(argumentos);
+    }
+
+    for (int t = 0; t < numThreads; t++) {
+        free(estado->locais[t]);
+    }
+    free(estado->locais);
+    free(estado->tamanhosLocais);
+    free(estado->capacidadesLocais);
+    free(estado->fronteira);
+    free(estado->proxima);
+}
+
+static void liberarEstadoBfsParalela(EstadoBfsParalela *estado) {
+    free(estado->niveis);
+    free(estado->pais);
+}
+
+// BFS paralela com o mesmo contrato de bfsComFilaArvore (sem árvore e sem saída)
+void bfsParalela(Grafo *grafo, int verticeInicial, int *visitados, int *pais, int *niveis, int numThreads) {
+    GrafoCSR *csr = obterCSR(grafo);
+    EstadoBfsParalela estado;
+    executarBuscaParalela(&estado, csr, visitados, verticeInicial, -1, numThreads);
+
+    for (int v = 0; v < csr->numVertices; v++) {
+        int nivel = atomic_load(&estado.niveis[v]);
+        if (nivel >= 0) {
+            visitados[v] = 1;
+            niveis[v] = nivel;
+            pais[v] = atomic_load(&estado.pais[v]);
+        }
+    }
+    liberarEstadoBfsParalela(&estado);
+}
+
+// Distância (em arestas) entre origem e destino, ou -1 se não houver caminho
+int calcularDistanciaParalela(Grafo *grafo, int origem, int destino, int numThreads) {
+    if (origem < 0 || origem >= grafo->numVertices || destino < 0 || destino >= grafo->numVertices) {
+        printf("Vértices inválidos.\n");
+        return -1;
+    }
+
+    EstadoBfsParalela estado;
+    executarBuscaParalela(&estado, obterCSR(grafo), NULL, origem, destino, numThreads);
+    int distancia = atomic_load(&estado.niveis[destino]);
+    liberarEstadoBfsParalela(&estado);
+    return distancia >= 0 ? distancia : -1;
+}
+
+// Versão paralela de encontrarCaminhoAumentante: preenche pais com um caminho mínimo
+// (em arestas) de origem a destino no grafo residual e retorna 1 se ele existir
+int encontrarCaminhoAumentanteParalelo(Grafo *grafoResidual, int origem, int destino, int *pais, int numThreads) {
+    GrafoCSR *csr = obterCSR(grafoResidual);
+    EstadoBfsParalela estado;
+    executarBuscaParalela(&estado, csr, NULL, origem, destino, numThreads);
+
+    for (int v = 0; v < csr->numVertices; v++) {
+        pais[v] = atomic_load(&estado.niveis[v]) >= 0 ? atomic_load(&estado.pais[v]) : -1;
+    }
+    pais[origem] = -1; // Como em encontrarCaminhoAumentante, a origem não tem pai
+    int encontrado = atomic_load(&estado.niveis[destino]) >= 0;
+    liberarEstadoBfsParalela(&estado);
+    return encontrado;
+}
+
+// Executa um lote de até 64 * PALAVRAS_MSBFS origens. Cada vértice guarda, por palavra,
+// o conjunto de buscas que já o alcançaram (vistos), as que o alcançaram no nível atual
+// (visitar) e as que o alcançarão no próximo (proximo); uma única varredura das arestas
+// de cada vértice serve a todas as buscas do lote.
+static void executarLoteMsBfs(GrafoCSR *csr, const int *origens, int numOrigens, int *distancias,
+                              PalavraBits *vistos, PalavraBits *visitar, PalavraBits *proximo) {
+    int n = csr->numVertices;
+    size_t tamanho = (size_t)n * PALAVRAS_MSBFS * sizeof(PalavraBits);
+    memset(vistos, 0, tamanho);
+    memset(visitar, 0, tamanho);
+    memset(proximo, 0, tamanho);
+
+    int ativo = 0;
+    for (int i = 0; i < numOrigens; i++) {
+        int s = origens[i];
+        if (s < 0 || s >= n) {
+            continue;
+        }
+        PalavraBits bit = 1ULL << (i & 63);
+        vistos[(size_t)s * PALAVRAS_MSBFS + (i >> 6)] |= bit;
+        visitar[(size_t)s * PALAVRAS_MSBFS + (i >> 6)] |= bit;
+        distancias[(size_t)i * n + s] = 0;
+        ativo = 1;
+    }
+
+    for (int nivel = 1; ativo; nivel++) {
+        ativo = 0;
+        for (int v = 0; v < n; v++) {
+            const PalavraBits *visitarV = visitar + (size_t)v * PALAVRAS_MSBFS;
+            PalavraBits qualquer = 0;
+            for (int k = 0; k < PALAVRAS_MSBFS; k++) {
+                qualquer |= visitarV[k];
+            }
+            if (qualquer == 0) {
+                continue;
+            }
+
+            for (long long e = csr->inicio[v]; e < csr->inicio[v + 1]; e++) {
+                int w = csr->destinos[e];
+                PalavraBits *vistosW = vistos + (size_t)w * PALAVRAS_MSBFS;
+                PalavraBits *proximoW = proximo + (size_t)w * PALAVRAS_MSBFS;
+                for (int k = 0; k < PALAVRAS_MSBFS; k++) {
+                    PalavraBits novos = visitarV[k] & ~vistosW[k];
+                    if (novos == 0) {
+                        continue;
+                    }
+                    proximoW[k] |= novos;
+                    vistosW[k] |= novos;
+                    // Registra a distância para cada busca que alcançou w agora
+                    while (novos != 0) {
+                        int i = k * 64 + __builtin_ctzll(novos);
+                        distancias[(size_t)i * n + w] = nivel;
+                        novos &= novos - 1;
+                    }
+                    ativo = 1;
+                }
+            }
+        }
+
+        // O próximo nível passa a ser o atual
+        PalavraBits *temp = visitar;
+        visitar = proximo;
+        proximo = temp;
+        memset(proximo, 0, tamanho);
+    }
+}
+
+void calcularDistanciasMultiplas(Grafo *grafo, const int *origens, int numOrigens, int *distancias) {
+    GrafoCSR *csr = obterCSR(grafo);
+    int n = csr->numVertices;
+    const int tamanhoLote = 64 * PALAVRAS_MSBFS;
+
+    for (long long i = 0; i < (long long)numOrigens * n; i++) {
+        distancias[i] = -1;
+    }
+    for (int i = 0; i < numOrigens; i++) {
+        if (origens[i] < 0 || origens[i] >= n) {
+            printf("Origem inválida: %d.\n", origens[i] + 1);
+        }
+    }
+
+    size_t tamanho = (size_t)n * PALAVRAS_MSBFS * sizeof(PalavraBits);
+    PalavraBits *vistos = (PalavraBits *)malloc(tamanho);
+    PalavraBits *visitar = (PalavraBits *)malloc(tamanho);
+    PalavraBits *proximo = (PalavraBits *)malloc(tamanho);
+    if (!vistos || !visitar || !proximo) {
+        fprintf(stderr, "Erro ao alocar memória para a BFS de múltiplas origens\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int inicioLote = 0; inicioLote < numOrigens; inicioLote += tamanhoLote) {
+        int numLote = numOrigens - inicioLote < tamanhoLote ? numOrigens - inicioLote : tamanhoLote;
+        executarLoteMsBfs(csr, origens + inicioLote, numLote, distancias + (size_t)inicioLote * n,
+                          vistos, visitar, proximo);
+    }
+
+    free(vistos);
+    free(visitar);
+    free(proximo);
+}
+
+// Busca bidirecional por níveis. As duas buscas usam gerações consecutivas do espaço de
+// trabalho (um vértice pertence a no máximo um dos lados) e compartilham a fila: a
+// direta cresce a partir do início e a reversa a partir do fim. O primeiro arco (u, v)
+// que liga os dois lados já fecha um caminho mínimo, pois nenhum vértice com
+// dOrigem <= nivelDireto tem dDestino <= nivelReverso antes do encontro.
+// Preenche pais (lado direto) e espaco->sucessores (lado reverso); com pais NULL só a
+// distância é calculada e nenhum dos dois é tocado.
+static int executarBfsBidirecional(GrafoCSR *csr, GrafoCSR *reverso, int origem, int destino, int *pais,
+                                   EspacoTrabalho *espaco, int *encontroU, int *encontroV) {
+    int n = csr->numVertices;
+    *encontroU = *encontroV = -1;
+    if (pais != NULL) {
+        pais[origem] = -1;
+    }
+    if (origem == destino) {
+        return 0;
+    }
+
+    iniciarBuscaEspaco(espaco, n);
+    if (espaco->geracao == UINT_MAX) {
+        iniciarBuscaEspaco(espaco, n);
+    }
+    unsigned int geracaoDireta = espaco->geracao;
+    unsigned int geracaoReversa = ++espaco->geracao;
+    unsigned int *marcas = espaco->marcas;
+    int *distancias = espaco->distancias;
+    int *sucessores = pais != NULL ? obterSucessoresEspaco(espaco) : NULL;
+    int *fila = espaco->fila;
+
+    // Fila direta em fila[0..], fila reversa em fila[n - 1], fila[n - 2], ...
+    int inicioDireto = 0, fimDireto = 1;
+    int inicioReverso = 0, fimReverso = 1;
+    fila[0] = origem;
+    fila[n - 1] = destino;
+    marcas[origem] = geracaoDireta;
+    marcas[destino] = geracaoReversa;
+    distancias[origem] = distancias[destino] = 0;
+    if (pais != NULL) {
+        sucessores[destino] = -1;
+    }
+    long long arestasDiretas = csr->inicio[origem + 1] - csr->inicio[origem];
+    long long arestasReversas = reverso->inicio[destino + 1] - reverso->inicio[destino];
+
+    while (inicioDireto < fimDireto && inicioReverso < fimReverso) {
+        if (arestasDiretas <= arestasReversas) {
+            int proximoFim = fimDireto;
+            arestasDiretas = 0;
+            for (int i = inicioDireto; i < fimDireto; i++) {
+                int u = fila[i];
+                for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+                    int v = csr->destinos[e];
+                    if (marcas[v] == geracaoReversa) {
+                        *encontroU = u;
+                        *encontroV = v;
+                        return distancias[u] + 1 + distancias[v];
+                    }
+                    if (marcas[v] != geracaoDireta) {
+                        marcas[v] = geracaoDireta;
+                        distancias[v] = distancias[u] + 1;
+                        if (pais != NULL) {
+                            pais[v] = u;
+                        }
+                        fila[proximoFim++] = v;
+                        arestasDiretas += csr->inicio[v + 1] - csr->inicio[v];
+                    }
+                }
+            }
+            inicioDireto = fimDireto;
+            fimDireto = proximoFim;
+        } else {
+            int proximoFim = fimReverso;
+            arestasReversas = 0;
+            for (int i = inicioReverso; i < fimReverso; i++) {
+                int v = fila[n - 1 - i];
+                for (long long e = reverso->inicio[v]; e < reverso->inicio[v + 1]; e++) {
+                    int u = reverso->destinos[e];
+                    if (marcas[u] == geracaoDireta) {
+                        *encontroU = u;
+                        *encontroV = v;
+                        return distancias[u] + 1 + distancias[v];
+                    }
+                    if (marcas[u] != geracaoReversa) {
+                        marcas[u] = geracaoReversa;
+                        distancias[u] = distancias[v] + 1;
+                        if (pais != NULL) {
+                            sucessores[u] = v;
+                        }
+                        fila[n - 1 - proximoFim++] = u;
+                        arestasReversas += reverso->inicio[u + 1] - reverso->inicio[u];
+                    }
+                }
+            }
+            inicioReverso = fimReverso;
+            fimReverso = proximoFim;
+        }
+    }
+
+    return -1;
+}
+
+int calcularDistanciaBidirecional(Grafo *grafo, int origem, int destino) {
+    EspacoTrabalho *espaco = criarEspacoTrabalho(grafo->numVertices);
+    int distancia = calcularDistanciaBidirecionalComEspaco(grafo, origem, destino, espaco);
+    liberarEspacoTrabalho(espaco);
+    return distancia;
+}
+
+int calcularDistanciaBidirecionalComEspaco(Grafo *grafo, int origem, int destino, EspacoTrabalho *espaco) {
+    if (origem < 0 || origem >= grafo->numVertices || destino < 0 || destino >= grafo->numVertices) {
+        printf("Vértices inválidos.\n");
+        return -1;
+    }
+
+    GrafoCSR *csr = obterCSR(grafo);
+    GrafoCSR *reverso = obterCSRReverso(grafo);
+    int u, v;
+    return executarBfsBidirecional(csr, reverso, origem, destino, NULL, espaco, &u, &v);
+}
+
+int encontrarCaminhoAumentanteBidirecional(Grafo *grafoResidual, int origem, int destino, int *pais) {
+    for (int i = 0; i < grafoResidual->numVertices; i++) {
+        pais[i] = -1;
+    }
+    EspacoTrabalho *espaco = criarEspacoTrabalho(grafoResidual->numVertices);
+    int encontrado = encontrarCaminhoAumentanteBidirecionalComEspaco(grafoResidual, origem, destino, pais, espaco);
+    liberarEspacoTrabalho(espaco);
+    return encontrado;
+}
+
+int encontrarCaminhoAumentanteBidirecionalComEspaco(Grafo *grafoResidual, int origem, int destino, int *pais,
+                                                     EspacoTrabalho *espaco) {
+    GrafoCSR *csr = obterCSR(grafoResidual);
+    GrafoCSR *reverso = obterCSRReverso(grafoResidual);
+    int u, v;
+    int distancia = executarBfsBidirecional(csr, reverso, origem, destino, pais, espaco, &u, &v);
+    if (distancia <= 0) {
+        return 0;
+    }
+
+    // Completa pais com a metade reversa do caminho: u -> v -> ... -> destino
+    pais[v] = u;
+    for (int w = v; w != destino; w = espaco->sucessores[w]) {
+        pais[espaco->sucessores[w]] = w;
+    }
+    return 1;
+}
@@ -0,0 +1,803 @@
+#include "../include/caminhos_minimos.h"
+#include "../include/execucao_paralela.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+#include <limits.h>
+#include <pthread.h>
+
+// Vetor dinâmico de vértices (um balde de uma thread)
+typedef struct {
+    int *dados;
+    long long tamanho;
+    long long capacidade;
+} VetorVertices;
+
+// Pedido de relaxação enviado à thread dona do vértice
+typedef struct {
+    int vertice;
+    double distancia;
+} PedidoRelaxacao;
+
+typedef struct {
+    PedidoRelaxacao *dados;
+    long long tamanho;
+    long long capacidade;
+} VetorPedidos;
+
+// Estado compartilhado do delta-stepping. O vértice v pertence à thread v % numThreads,
+// que é a única a escrever distancia[v] e a guardar v em seus baldes; as demais só enviam
+// pedidos. As fases de relaxação e de aplicação são separadas por barreiras, então as
+// leituras de distancia durante a relaxação não disputam com escritas.
+typedef struct {
+    GrafoCSR *csr;
+    GrafoCSR *reverso;
+    int origem;
+    double delta;
+    long long numBaldes;            // Baldes circulares por thread
+    int numThreads;
+    double *distancia;
+    int *pais;
+    long long *baldePendente;       // Balde (absoluto) em que v aguarda, ou -1
+    long long *ultimoRemovido;      // Último balde em que v entrou no conjunto de removidos
+    VetorVertices *baldes;          // baldes[t * numBaldes + b]
+    long long *pendentes;           // Entradas nos baldes de cada thread
+    VetorVertices *removidos;       // Vértices retirados do balde atual, por thread
+    VetorPedidos *pedidos;          // pedidos[emissor * numThreads + dono]
+    int *temTrabalho;
+    long long *proximoBalde;
+    pthread_barrier_t barreira;
+} EstadoDeltaStepping;
+
+typedef struct {
+    EstadoDeltaStepping *estado;
+    int id;
+} ArgumentoDeltaStepping;
+
+static void inserirVetorVertices(VetorVertices *vetor, int v) {
+    if (vetor->tamanho == vetor->capacidade) {
+        vetor->capacidade = vetor->capacidade > 0 ? vetor->capacidade * 2 : 16;
+        vetor->dados = (int *)realloc(vetor->dados, (size_t)vetor->capacidade * sizeof(int));
+        if (!vetor->dados) {
+            fprintf(stderr, "Erro ao alocar memória para os baldes do delta-stepping\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    vetor->dados[vetor->tamanho++] = v;
+}
+
+static void inserirPedido(VetorPedidos *vetor, int v, double distancia) {
+    if (vetor->tamanho == vetor->capacidade) {
+        vetor->capacidade = vetor->capacidade > 0 ? vetor->capacidade * 2 : 16;
+        vetor->dados = (PedidoRelaxacao *)realloc(vetor->dados, (size_t)vetor->capacidade * sizeof(PedidoRelaxacao));
+        if (!vetor->dados) {
+            fprintf(stderr, "Erro ao alocar memória para os pedidos do delta-stepping\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    vetor->dados[vetor->tamanho].vertice = v;
+    vetor->dados[vetor->tamanho].distancia = distancia;
+    vetor->tamanho++;
+}
+
+// Guarda v no balde correspondente à sua distância (se ainda não estiver nele). O balde
+// nunca é anterior a baldeMinimo, o que protege contra o arredondamento de distancia / delta.
+static void inserirBaldeDelta(EstadoDeltaStepping *estado, int id, int v, long long baldeMinimo) {
+    long long balde = (long long)(estado->distancia[v] / estado->delta);
+    if (balde < baldeMinimo) {
+        balde = baldeMinimo;
+    }
+    if (estado->baldePendente[v] == balde) {
+        return;
+    }
+    estado->baldePendente[v] = balde;
+    inserirVetorVertices(&estado->baldes[(long long)id * estado->numBaldes + balde % estado->numBaldes], v);
+    estado->pendentes[id]++;
+}
+
+// Relaxa as arestas de u com peso em (pesoMinimo, pesoMaximo], gerando pedidos para os donos
+static void relaxarArestasDelta(EstadoDeltaStepping *estado, int id, int u, double pesoMinimo, double pesoMaximo) {
+    GrafoCSR *csr = estado->csr;
+    int numThreads = estado->numThreads;
+    double distanciaU = estado->distancia[u];
+    for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+        double peso = csr->pesos[e];
+        if (peso <= pesoMinimo || peso > pesoMaximo) {
+            continue;
+        }
+        int v = csr->destinos[e];
+        double novaDistancia = distanciaU + peso;
+        if (novaDistancia < estado->distancia[v]) {
+            inserirPedido(&estado->pedidos[(long long)id * numThreads + v % numThreads], v, novaDistancia);
+        }
+    }
+}
+
+// Aplica os pedidos endereçados à thread id (chamada entre barreiras)
+static void aplicarPedidosDelta(EstadoDeltaStepping *estado, int id, long long baldeMinimo) {
+    int numThreads = estado->numThreads;
+    for (int emissor = 0; emissor < numThreads; emissor++) {
+        VetorPedidos *pedidos = &estado->pedidos[(long long)emissor * numThreads + id];
+        for (long long i = 0; i < pedidos->tamanho; i++) {
+            int v = pedidos->dados[i].vertice;
+            if (pedidos->dados[i].distancia < estado->distancia[v]) {
+                estado->distancia[v] = pedidos->dados[i].distancia;
+                inserirBaldeDelta(estado, id, v, baldeMinimo);
+            }
+        }
+        pedidos->tamanho = 0;
+    }
+}
+
+// Pai de v pela regra do Dijkstra com heap: entre os predecessores u com
+// distancia[u] + peso == distancia[v] e distancia[u] < distancia[v], o de menor
+// (distancia[u], u). Retorna -2 se nenhum satisfizer (empates por arestas de peso zero).
+static int escolherPaiDelta(EstadoDeltaStepping *estado, int v) {
+    GrafoCSR *reverso = estado->reverso;
+    double *distancia = estado->distancia;
+    int pai = -2;
+    for (long long e = reverso->inicio[v]; e < reverso->inicio[v + 1]; e++) {
+        int u = reverso->destinos[e];
+        if (distancia[u] == DBL_MAX || distancia[u] >= distancia[v] || distancia[u] + reverso->pesos[e] != distancia[v]) {
+            continue;
+        }
+        if (pai < 0 || distancia[u] < distancia[pai] || (distancia[u] == distancia[pai] && u < pai)) {
+            pai = u;
+        }
+    }
+    return pai;
+}
+
+static void *executarDeltaStepping(void *argumento) {
+    ArgumentoDeltaStepping *arg = (ArgumentoDeltaStepping *)argumento;
+    EstadoDeltaStepping *estado = arg->estado;
+    int id = arg->id;
+    int numThreads = estado->numThreads;
+    long long numBaldes = estado->numBaldes;
+    double delta = estado->delta;
+    VetorVertices *meusBaldes = &estado->baldes[(long long)id * numBaldes];
+    VetorVertices *removidos = &estado->removidos[id];
+    long long atual = 0;
+
+    while (1) {
+        // Próximo balde não vazio: mínimo entre os baldes locais de todas as threads.
+        // Nenhuma entrada pendente está a mais de numBaldes - 1 baldes do atual.
+        long long proximo = LLONG_MAX;
+        if (estado->pendentes[id] > 0) {
+            for (long long k = 0; k < numBaldes; k++) {
+                if (meusBaldes[(atual + k) % numBaldes].tamanho > 0) {
+                    proximo = atual + k;
+                    break;
+                }
+            }
+        }
+        estado->proximoBalde[id] = proximo;
+        pthread_barrier_wait(&estado->barreira);
+        atual = LLONG_MAX;
+        for (int t = 0; t < numThreads; t++) {
+            if (estado->proximoBalde[t] < atual) {
+                atual = estado->proximoBalde[t];
+            }
+        }
+        if (atual == LLONG_MAX) {
+            break;
+        }
+
+        // Fases leves: esvaziam o balde atual até que nenhuma thread o reabasteça
+        VetorVertices *balde = &meusBaldes[atual % numBaldes];
+        removidos->tamanho = 0;
+        while (1) {
+            for (long long i = 0; i < balde->tamanho; i++) {
+                int u = balde->dados[i];
+                estado->pendentes[id]--;
+                if (estado->baldePendente[u] != atual) {
+                    continue; // Entrada obsoleta: u já foi melhorado para outro balde
+                }
+                estado->baldePendente[u] = -1;
+                if (estado->ultimoRemovido[u] != atual) {
+                    estado->ultimoRemovido[u] = atual;
+                    inserirVetorVertices(removidos, u);
+                }
+                relaxarArestasDelta(estado, id, u, -1.0, delta);
+            }
+            balde->tamanho = 0;
+            pthread_barrier_wait(&estado->barreira);
+
+            aplicarPedidosDelta(estado, id, atual);
+            estado->temTrabalho[id] = balde->tamanho > 0;
+            pthread_barrier_wait(&estado->barreira);
+
+            int algumTrabalho = 0;
+            for (int t = 0; t < numThreads; t++) {
+                algumTrabalho |= estado->temTrabalho[t];
+            }
+            if (!algumTrabalho) {
+                break;
+            }
+        }
+
+        // Fase pesada: cada vértice removido relaxa suas arestas pesadas uma única vez,
+        // sempre para baldes posteriores ao atual
+        for (long long i = 0; i < removidos->tamanho; i++) {
+            relaxarArestasDelta(estado, id, removidos->dados[i], delta, DBL_MAX);
+        }
+        pthread_barrier_wait(&estado->barreira);
+        aplicarPedidosDelta(estado, id, atual + 1);
+        pthread_barrier_wait(&estado->barreira);
+        atual++;
+    }
+
+    // Pais escolhidos a partir das distâncias finais, independentes da ordem de relaxação
+    int n = estado->csr->numVertices;
+    int inicio = (int)((long long)n * id / numThreads);
+    int fim = (int)((long long)n * (id + 1) / numThreads);
+    int faltaPai = 0;
+    for (int v = inicio; v < fim; v++) {
+        if (v == estado->origem || estado->distancia[v] == DBL_MAX) {
+            continue;
+        }
+        estado->pais[v] = escolherPaiDelta(estado, v);
+        faltaPai |= estado->pais[v] == -2;
+    }
+    estado->temTrabalho[id] = faltaPai;
+    return NULL;
+}
+
+// Completa os pais que dependem só de arestas de peso zero com uma busca pelas arestas
+// justas a partir dos vértices que já têm pai
+static void corrigirPaisPesoZero(GrafoCSR *csr, int origem, const double *distancia, int *pais) {
+    int n = csr->numVertices;
+    int *fila = (int *)malloc((size_t)n * sizeof(int));
+    if (!fila) {
+        fprintf(stderr, "Erro ao alocar memória para a fila do delta-stepping\n");
+        exit(EXIT_FAILURE);
+    }
+    int inicioFila = 0, fimFila = 0;
+    for (int v = 0; v < n; v++) {
+        if (distancia[v] != DBL_MAX && (v == origem || pais[v] != -2)) {
+            fila[fimFila++] = v;
+        }
+    }
+    while (inicioFila < fimFila) {
+        int u = fila[inicioFila++];
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int v = csr->destinos[e];
+            if (v != origem && pais[v] == -2 && distancia[u] + csr->pesos[e] == distancia[v]) {
+                pais[v] = u;
+                fila[fimFila++] = v;
+            }
+        }
+    }
+    free(fila);
+}
+
+// Ajusta o estado ao número efetivo de threads: a barreira e o dono da origem dependem dele
+static void prepararDeltaStepping(void *contexto, int numThreads) {
+    EstadoDeltaStepping *estado = (EstadoDeltaStepping *)contexto;
+    estado->numThreads = numThreads;
+    pthread_barrier_init(&estado->barreira, NULL, (unsigned)numThreads);
+    inserirBaldeDelta(estado, estado->origem % numThreads, estado->origem, 0);
+}
+
+void dijkstraDeltaStepping(Grafo *grafo, int origem, double delta, int numThreads, int imprimir,
+                           double *distancia, int *pais) {
+    GrafoCSR *csr = obterCSR(grafo);
+    int n = csr->numVertices;
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+
+    for (int v = 0; v < n; v++) {
+        distancia[v] = DBL_MAX;
+        pais[v] = -1;
+    }
+
+    double pesoMaximo = 0.0;
+    for (long long e = 0; e < csr->numArestas; e++) {
+        if (csr->pesos[e] < 0) {
+            printf("Erro: o delta-stepping não admite arestas de peso negativo.\n");
+            return;
+        }
+        if (csr->pesos[e] > pesoMaximo) {
+            pesoMaximo = csr->pesos[e];
+        }
+    }
+    if (delta <= 0) {
+        double grauMedio = n > 0 ? (double)csr->numArestas / n : 0.0;
+        delta = grauMedio > 1.0 ? pesoMaximo / grauMedio : pesoMaximo;
+    }
+    if (pesoMaximo / (MAXIMO_BALDES_DELTA - 3) > delta) {
+        delta = pesoMaximo / (MAXIMO_BALDES_DELTA - 3);
+    }
+    if (delta <= 0) {
+        delta = 1.0;
+    }
+
+    EstadoDeltaStepping estado;
+    estado.csr = csr;
+    estado.reverso = obterCSRReverso(grafo);
+    estado.origem = origem;
+    estado.delta = delta;
+    // Folga de dois baldes para o arredondamento de distancia / delta
+    estado.numBaldes = (long long)(pesoMaximo / delta) + 3;
+    estado.numThreads = numThreads;
+    estado.distancia = distancia;
+    estado.pais = pais;
+    estado.baldePendente = (long long *)malloc((size_t)n * sizeof(long long));
+    estado.ultimoRemovido = (long long *)malloc((size_t)n * sizeof(long long));
+    estado.baldes = (VetorVertices *)calloc((size_t)(numThreads * estado.numBaldes), sizeof(VetorVertices));
+    estado.pendentes = (long long *)calloc((size_t)numThreads, sizeof(long long));
+    estado.removidos = (VetorVertices *)calloc((size_t)numThreads, sizeof(VetorVertices));
+    estado.pedidos = (VetorPedidos *)calloc((size_t)numThreads * (size_t)numThreads, sizeof(VetorPedidos));
+    estado.temTrabalho = (int *)calloc((size_t)numThreads, sizeof(int));
+    estado.proximoBalde = (long long *)malloc((size_t)numThreads * sizeof(long long));
+    if (!estado.baldePendente || !estado.ultimoRemovido || !estado.baldes || !estado.pendentes ||
+        !estado.removidos || !estado.pedidos || !estado.temTrabalho || !estado.proximoBalde) {
+        fprintf(stderr, "Erro ao alocar memória para o delta-stepping\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        estado.baldePendente[v] = -1;
+        estado.ultimoRemovido[v] = -1;
+    }
+    distancia[origem] = 0.0;
+
+    ArgumentoDeltaStepping *argumentos =
+        (ArgumentoDeltaStepping *)malloc((size_t)numThreads * sizeof(ArgumentoDeltaStepping));
+    if (!argumentos) {
+        fprintf(stderr, "Erro ao alocar memória para as threads\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int t = 0; t < numThreads; t++) {
+        argumentos[t].estado = &estado;
+        argumentos[t].id = t;
+    }
+    // Os vetores por thread ficam com o tamanho pedido; só os das threads criadas são usados
+    executarEmParalelo(numThreads, executarDeltaStepping, argumentos, sizeof(ArgumentoDeltaStepping),
+                       prepararDeltaStepping, &estado);
+    pthread_barrier_destroy(&estado.barreira);
+    free(argumentos);
+
+    for (int t = 0; t < numThreads; t++) {
+        if (estado.temTrabalho[t]) {
+            corrigirPaisPesoZero(csr, origem, distancia, pais);
+            break;
+        }
+    }
+
+    for (long long i = 0; i < numThreads * estado.numBaldes; i++) {
+        free(estado.baldes[i].dados);
+    }
+    for (long long i = 0; i < (long long)numThreads * numThreads; i++) {
+        free(estado.pedidos[i].dados);
+    }
+    for (int t = 0; t < numThreads; t++) {
+        free(estado.removidos[t].dados);
+    }
+    free(estado.baldePendente);
+    free(estado.ultimoRemovido);
+    free(estado.baldes);
+    free(estado.pendentes);
+    free(estado.removidos);
+    free(estado.pedidos);
+    free(estado.temTrabalho);
+    free(estado.proximoBalde);
+
+    imprimirCaminhosMinimos(imprimir, origem, distancia, pais, n, obterIdsExternos(grafo));
+}
+
+// Procura um ciclo no grafo de pais (cada vértice aponta para o seu pai) e retorna um
+// vértice do ciclo, ou -1. marcas guarda em qual caminhada cada vértice foi visitado.
+static int encontrarCicloPais(const int *pais, int numVertices, int *marcas) {
+    for (int v = 0; v < numVertices; v++) {
+        marcas[v] = -1;
+    }
+    for (int s = 0; s < numVertices; s++) {
+        int x = s;
+        while (x != -1 && marcas[x] == -1) {
+            marcas[x] = s;
+            x = pais[x];
+        }
+        if (x != -1 && marcas[x] == s) {
+            return x;
+        }
+    }
+    return -1;
+}
+
+// Escreve em ciclo os vértices do ciclo de pais que contém x, na ordem dos arcos
+static int extrairCicloPais(const int *pais, int x, int *ciclo) {
+    int tamanho = 0;
+    int v = x;
+    do {
+        ciclo[tamanho++] = v;
+        v = pais[v];
+    } while (v != x);
+    // Os pais percorrem os arcos ao contrário
+    for (int i = 0, j = tamanho - 1; i < j; i++, j--) {
+        int temp = ciclo[i];
+        ciclo[i] = ciclo[j];
+        ciclo[j] = temp;
+    }
+    return tamanho;
+}
+
+// Núcleo do Bellman-Ford com fila sobre o CSR. Com origem -1 todos os vértices começam
+// com distância 0, como se uma origem virtual tivesse arcos de peso 0 para cada um
+// (potenciais de Johnson). Retorna o tamanho do ciclo negativo escrito em ciclo
+// (capacidade numVertices), ou 0 se não houver ciclo alcançável.
+static int executarBellmanFordFila(GrafoCSR *csr, int origem, double *distancia, int *pais, int *ciclo) {
+    int n = csr->numVertices;
+
+    // Fila circular com no máximo uma ocorrência de cada vértice
+    int *fila = (int *)malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    int *comprimento = (int *)malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    int *marcas = (int *)malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    char *naFila = (char *)calloc((size_t)(n > 0 ? n : 1), sizeof(char));
+    if (!fila || !comprimento || !marcas || !naFila) {
+        fprintf(stderr, "Erro ao alocar memória para o Bellman-Ford\n");
+        exit(EXIT_FAILURE);
+    }
+    int inicio = 0, tamanho = 0;
+    for (int v = 0; v < n; v++) {
+        distancia[v] = origem == -1 ? 0.0 : DBL_MAX;
+        pais[v] = -1;
+        comprimento[v] = 0;
+        if (origem == -1) {
+            fila[tamanho++] = v;
+            naFila[v] = 1;
+        }
+    }
+    if (origem != -1) {
+        distancia[origem] = 0.0;
+        fila[tamanho++] = origem;
+        naFila[origem] = 1;
+    }
+    double soma = 0.0; // Soma das distâncias dos vértices na fila (para o LLL)
+
+    // Um caminho de pais com n arcos indica um possível ciclo negativo; o grafo de pais é
+    // verificado nesse momento e, se ainda não houver ciclo, só quando o limite dobrar
+    int limiteComprimento = n;
+    int verticeCiclo = -1;
+
+    while (tamanho > 0 && verticeCiclo == -1) {
+        // LLL: adia os vértices do início cuja distância supera a média da fila
+        for (int giros = 1; giros < tamanho && distancia[fila[inicio]] * tamanho > soma; giros++) {
+            int v = fila[inicio];
+            inicio = (inicio + 1) % n;
+            fila[(inicio + tamanho - 1) % n] = v;
+        }
+        int u = fila[inicio];
+        inicio = (inicio + 1) % n;
+        tamanho--;
+        naFila[u] = 0;
+        soma -= distancia[u];
+
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int v = csr->destinos[e];
+            double novaDistancia = distancia[u] + csr->pesos[e];
+            if (novaDistancia >= distancia[v]) {
+                continue;
+            }
+            if (naFila[v]) {
+                soma += novaDistancia - distancia[v];
+            }
+            distancia[v] = novaDistancia;
+            pais[v] = u;
+            comprimento[v] = comprimento[u] + 1;
+
+            if (comprimento[v] >= limiteComprimento) {
+                verticeCiclo = encontrarCicloPais(pais, n, marcas);
+                if (verticeCiclo != -1) {
+                    break;
+                }
+                limiteComprimento = limiteComprimento > INT_MAX / 2 ? INT_MAX : limiteComprimento * 2;
+            }
+
+            if (!naFila[v]) {
+                naFila[v] = 1;
+                soma += novaDistancia;
+                // SLF: distância menor que a do início da fila entra na frente
+                if (tamanho > 0 && novaDistancia < distancia[fila[inicio]]) {
+                    inicio = (inicio + n - 1) % n;
+                    fila[inicio] = v;
+                } else {
+                    fila[(inicio + tamanho) % n] = v;
+                }
+                tamanho++;
+            }
+        }
+    }
+
+    int tamanhoCiclo = 0;
+    if (verticeCiclo != -1) {
+        tamanhoCiclo = extrairCicloPais(pais, verticeCiclo, ciclo);
+    }
+    free(fila);
+    free(comprimento);
+    free(marcas);
+    free(naFila);
+    return tamanhoCiclo;
+}
+
+// Informa o ciclo negativo com os IDs externos dos vértices (origem -1 para a origem
+// virtual de Johnson)
+static void escreverCicloNegativo(Grafo *grafo, int origem, const int *ciclo, int tamanhoCiclo) {
+    if (origem == -1) {
+        printf("Erro: ciclo negativo no grafo: ");
+    } else {
+        printf("Erro: ciclo negativo alcançável a partir do vértice %lld: ", rotuloVertice(grafo, origem));
+    }
+    for (int i = 0; i <= tamanhoCiclo; i++) {
+        printf(i > 0 ? " -> %lld" : "%lld", rotuloVertice(grafo, ciclo[i % tamanhoCiclo]));
+    }
+    printf("\n");
+}
+
+int bellmanFordFila(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais,
+                    int *ciclo, int *tamanhoCiclo) {
+    GrafoCSR *csr = obterCSR(grafo);
+    int n = csr->numVertices;
+    int *cicloEncontrado = (int *)malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    if (!cicloEncontrado) {
+        fprintf(stderr, "Erro ao alocar memória para o Bellman-Ford\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int tamanhoEncontrado = executarBellmanFordFila(csr, origem, distancia, pais, cicloEncontrado);
+    if (tamanhoEncontrado > 0) {
+        escreverCicloNegativo(grafo, origem, cicloEncontrado, tamanhoEncontrado);
+        if (ciclo != NULL) {
+            for (int i = 0; i < tamanhoEncontrado; i++) {
+                ciclo[i] = cicloEncontrado[i];
+            }
+        }
+    }
+    if (tamanhoCiclo != NULL) {
+        *tamanhoCiclo = tamanhoEncontrado;
+    }
+    free(cicloEncontrado);
+
+    if (tamanhoEncontrado == 0) {
+        imprimirCaminhosMinimos(imprimir, origem, distancia, pais, n, obterIdsExternos(grafo));
+    }
+    return tamanhoEncontrado == 0;
+}
+
+int calcularPotenciaisJohnson(Grafo *grafo, double *potenciais) {
+    GrafoCSR *csr = obterCSR(grafo);
+    int n = csr->numVertices;
+    int *pais = (int *)malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    int *ciclo = (int *)malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    if (!pais || !ciclo) {
+        fprintf(stderr, "Erro ao alocar memória para os potenciais de Johnson\n");
+        exit(EXIT_FAILURE);
+    }
+    int tamanhoCiclo = executarBellmanFordFila(csr, -1, potenciais, pais, ciclo);
+    if (tamanhoCiclo > 0) {
+        escreverCicloNegativo(grafo, -1, ciclo, tamanhoCiclo);
+    }
+    free(pais);
+    free(ciclo);
+    return tamanhoCiclo == 0;
+}
+
+int ordenarTopologicamente(Grafo *grafo, int *ordem) {
+    GrafoCSR *csr = obterCSR(grafo);
+    int n = csr->numVertices;
+    // Caso comum em DAGs de entrada: todos os arcos já vão de um índice menor para um
+    // maior, e a ordem dos índices é topológica (e sequencial na memória)
+    int crescente = 1;
+    for (int u = 0; u < n && crescente; u++) {
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            if (csr->destinos[e] <= u) {
+                crescente = 0;
+                break;
+            }
+        }
+    }
+    if (crescente) {
+        for (int v = 0; v < n; v++) {
+            ordem[v] = v;
+        }
+        return 1;
+    }
+
+    int *grauEntrada = (int *)calloc((size_t)(n > 0 ? n : 1), sizeof(int));
+    if (!grauEntrada) {
+        fprintf(stderr, "Erro ao alocar memória para a ordenação topológica\n");
+        exit(EXIT_FAILURE);
+    }
+    for (long long e = 0; e < csr->numArestas; e++) {
+        grauEntrada[csr->destinos[e]]++;
+    }
+
+    // Algoritmo de Kahn: o próprio vetor de saída serve de fila
+    int fim = 0;
+    for (int v = 0; v < n; v++) {
+        if (grauEntrada[v] == 0) {
+            ordem[fim++] = v;
+        }
+    }
+    for (int inicio = 0; inicio < fim; inicio++) {
+        int u = ordem[inicio];
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int v = csr->destinos[e];
+            if (--grauEntrada[v] == 0) {
+                ordem[fim++] = v;
+            }
+        }
+    }
+
+    free(grauEntrada);
+    return fim == n;
+}
+
+int caminhosMinimosDag(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais, const int *ordem) {
+    GrafoCSR *csr = obterCSR(grafo);
+    int n = csr->numVertices;
+    int *ordemCalculada = NULL;
+    if (ordem == NULL) {
+        ordemCalculada = (int *)malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+        if (!ordemCalculada) {
+            fprintf(stderr, "Erro ao alocar memória para a ordenação topológica\n");
+            exit(EXIT_FAILURE);
+        }
+        if (!ordenarTopologicamente(grafo, ordemCalculada)) {
+            printf("Erro: o grafo possui ciclo; caminhos mínimos por ordem topológica exigem um DAG.\n");
+            free(ordemCalculada);
+            return 0;
+        }
+        ordem = ordemCalculada;
+    }
+
+    for (int v = 0; v < n; v++) {
+        distancia[v] = DBL_MAX;
+        pais[v] = -1;
+    }
+    distancia[origem] = 0.0;
+
+    // Cada vértice relaxa suas arestas depois de todos os predecessores: um único passe,
+    // válido também com pesos negativos. Os vértices antes da origem são inalcançáveis.
+    int i = 0;
+    while (ordem[i] != origem) {
+        i++;
+    }
+    for (; i < n; i++) {
+        int u = ordem[i];
+        if (distancia[u] == DBL_MAX) {
+            continue;
+        }
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int v = csr->destinos[e];
+            double novaDistancia = distancia[u] + csr->pesos[e];
+            if (novaDistancia < distancia[v]) {
+                distancia[v] = novaDistancia;
+                pais[v] = u;
+            }
+        }
+    }
+    free(ordemCalculada);
+
+    imprimirCaminhosMinimos(imprimir, origem, distancia, pais, n, obterIdsExternos(grafo));
+    return 1;
+}
+
+// Busca binária no vetor ordenado de alvos
+static int ehAlvoDijkstra(const int *alvos, int numAlvos, int v) {
+    int inicio = 0, fim = numAlvos - 1;
+    while (inicio <= fim) {
+        int meio = inicio + (fim - inicio) / 2;
+        if (alvos[meio] == v) {
+            return 1;
+        }
+        if (alvos[meio] < v) {
+            inicio = meio + 1;
+        } else {
+            fim = meio - 1;
+        }
+    }
+    return 0;
+}
+
+int dijkstraLimitado(Grafo *grafo, int origem, const OpcoesDijkstra *opcoes, double *distancia, int *pais,
+                     int *finalizados, EspacoTrabalho *espaco) {
+    GrafoCSR *csr = obterCSR(grafo);
+    if (obterPesosNegativos(csr)) {
+        printf("Erro: o Dijkstra limitado não admite arestas de peso negativo.\n");
+        return 0;
+    }
+    double raio = opcoes != NULL && opcoes->raio > 0.0 ? opcoes->raio : DBL_MAX;
+    int k = opcoes != NULL && opcoes->k > 0 ? opcoes->k : 0;
+
+    // Cópia ordenada e sem repetições dos alvos, para não marcar um vetor de tamanho n
+    int *alvos = NULL;
+    int numAlvos = 0;
+    if (opcoes != NULL && opcoes->alvos != NULL && opcoes->numAlvos > 0) {
+        alvos = (int *)malloc((size_t)opcoes->numAlvos * sizeof(int));
+        if (!alvos) {
+            fprintf(stderr, "Erro ao alocar memória para os alvos do Dijkstra\n");
+            exit(EXIT_FAILURE);
+        }
+        memcpy(alvos, opcoes->alvos, (size_t)opcoes->numAlvos * sizeof(int));
+        qsort(alvos, (size_t)opcoes->numAlvos, sizeof(int), compararInteiros);
+        for (int i = 0; i < opcoes->numAlvos; i++) {
+            if (numAlvos == 0 || alvos[i] != alvos[numAlvos - 1]) {
+                alvos[numAlvos++] = alvos[i];
+            }
+        }
+    }
+
+    iniciarBuscaEspaco(espaco, csr->numVertices);
+    unsigned int geracao = espaco->geracao;
+    unsigned int *alcancados = espaco->marcas;
+    HeapIndexado *heap = obterHeapEspaco(espaco);
+    heap->tamanho = 0;
+
+    alcancados[origem] = geracao;
+    distancia[origem] = 0.0;
+    pais[origem] = -1;
+    inserirHeapIndexado(heap, origem, 0.0);
+
+    int numFinalizados = 0;
+    int encontrados = 0; // Alvos finalizados, ou vértices além da origem sem alvos
+    while (heap->tamanho > 0) {
+        int u = extrairMinimoHeapIndexado(heap).vertice;
+        finalizados[numFinalizados++] = u;
+        if (alvos != NULL ? ehAlvoDijkstra(alvos, numAlvos, u) : u != origem) {
+            encontrados++;
+            if ((k > 0 && encontrados >= k) || (alvos != NULL && encontrados == numAlvos)) {
+                break;
+            }
+        }
+
+        // Vértices além do raio nunca entram no heap
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int v = csr->destinos[e];
+            double novaDistancia = distancia[u] + csr->pesos[e];
+            if (novaDistancia > raio) {
+                continue;
+            }
+            if (alcancados[v] != geracao) {
+                alcancados[v] = geracao;
+                distancia[v] = novaDistancia;
+                pais[v] = u;
+                inserirHeapIndexado(heap, v, novaDistancia);
+            } else if (heap->posicoes[v] >= 0 && novaDistancia < distancia[v]) {
+                distancia[v] = novaDistancia;
+                pais[v] = u;
+                diminuirChaveHeapIndexado(heap, v, novaDistancia);
+            }
+        }
+    }
+
+    free(alvos);
+    return numFinalizados;
+}
+
+int calcularCaminhosMinimos(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais) {
+    // Grafos direcionados acíclicos dispensam o heap: uma passada de Kahn detecta o caso
+    // e a ordem obtida é reaproveitada pela relaxação
+    if (grafo->direcionado) {
+        int n = grafo->numVertices;
+        int *ordem = (int *)malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+        if (!ordem) {
+            fprintf(stderr, "Erro ao alocar memória para a ordenação topológica\n");
+            exit(EXIT_FAILURE);
+        }
+        int aciclico = ordenarTopologicamente(grafo, ordem);
+        if (aciclico) {
+            caminhosMinimosDag(grafo, origem, imprimir, distancia, pais, ordem);
+        }
+        free(ordem);
+        if (aciclico) {
+            return 1;
+        }
+    }
+    if (possuiPesosNegativos(grafo)) {
+        return bellmanFordFila(grafo, origem, imprimir, distancia, pais, NULL, NULL);
+    }
+    dijkstraHeap(grafo, origem, imprimir, distancia, pais);
+    return 1;
+}
@@ -0,0 +1,615 @@
+#include "../include/componentes.h"
+#include "../include/gerador.h"
+#include "../include/leitura.h"
+#include "../include/execucao_paralela.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+// Numera as componentes a partir de 1 na ordem do menor vértice, dado o representante
+// (raiz) de cada vértice
+static void rotularComponentes(int n, const int *raizes, int *componentes, int *numComponentes) {
+    int *rotulos = (int *)calloc((size_t)n, sizeof(int));
+    if (!rotulos) {
+        fprintf(stderr, "Erro ao alocar memória para os rótulos das componentes\n");
+        exit(EXIT_FAILURE);
+    }
+    *numComponentes = 0;
+    for (int v = 0; v < n; v++) {
+        int raiz = raizes[v];
+        if (rotulos[raiz] == 0) {
+            rotulos[raiz] = ++(*numComponentes);
+        }
+        componentes[v] = rotulos[raiz];
+    }
+    free(rotulos);
+}
+
+// Busca com compressão de caminho por divisão pela metade (iterativa)
+static int encontrarRaiz(int *pai, int v) {
+    while (pai[v] != v) {
+        pai[v] = pai[pai[v]];
+        v = pai[v];
+    }
+    return v;
+}
+
+void descobrirComponentesUnionFind(Grafo *grafo, int *componentes, int *numComponentes) {
+    GrafoCSR *csr = obterCSR(grafo);
+    int n = csr->numVertices;
+    int *pai = (int *)malloc((size_t)n * sizeof(int));
+    int *tamanho = (int *)malloc((size_t)n * sizeof(int));
+    if (!pai || !tamanho) {
+        fprintf(stderr, "Erro ao alocar memória para o union-find\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        pai[v] = v;
+        tamanho[v] = 1;
+    }
+
+    for (int u = 0; u < n; u++) {
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int a = encontrarRaiz(pai, u);
+            int b = encontrarRaiz(pai, csr->destinos[e]);
+            if (a == b) {
+                continue;
+            }
+            // União por tamanho
+            if (tamanho[a] < tamanho[b]) {
+                int temp = a;
+                a = b;
+                b = temp;
+            }
+            pai[b] = a;
+            tamanho[a] += tamanho[b];
+        }
+    }
+
+    for (int v = 0; v < n; v++) {
+        pai[v] = encontrarRaiz(pai, v);
+    }
+    rotularComponentes(n, pai, componentes, numComponentes);
+
+    free(pai);
+    free(tamanho);
+}
+
+// Estado compartilhado da variante paralela
+typedef struct {
+    GrafoCSR *csr;
+    atomic_int *comp;
+    int numThreads;
+    int podePular;          // Pular a componente maior só é válido com arestas simétricas
+    int componenteFrequente;
+    pthread_barrier_t barreira;
+} EstadoAfforest;
+
+typedef struct {
+    EstadoAfforest *estado;
+    int id;
+} ArgumentoAfforest;
+
+// União sem travas: a raiz de maior índice passa a apontar para a de menor índice,
+// de modo que a raiz final de cada componente é o seu menor vértice
+static void unirAfforest(atomic_int *comp, int u, int v) {
+    int p1 = atomic_load_explicit(&comp[u], memory_order_relaxed);
+    int p2 = atomic_load_explicit(&comp[v], memory_order_relaxed);
+    while (p1 != p2) {
+        int alto = p1 > p2 ? p1 : p2;
+        int baixo = p1 + p2 - alto;
+        int paiAlto = atomic_load_explicit(&comp[alto], memory_order_relaxed);
+        if (paiAlto == baixo) {
+            break;
+        }
+        if (paiAlto == alto &&
+            atomic_compare_exchange_strong_explicit(&comp[alto], &paiAlto, baixo, memory_order_relaxed, memory_order_relaxed)) {
+            break;
+        }
+        p1 = atomic_load_explicit(&comp[atomic_load_explicit(&comp[alto], memory_order_relaxed)], memory_order_relaxed);
+        p2 = atomic_load_explicit(&comp[baixo], memory_order_relaxed);
+    }
+}
+
+static void comprimirAfforest(atomic_int *comp, int inicio, int fim) {
+    for (int v = inicio; v < fim; v++) {
+        int p = atomic_load_explicit(&comp[v], memory_order_relaxed);
+        int avo = atomic_load_explicit(&comp[p], memory_order_relaxed);
+        while (p != avo) {
+            atomic_store_explicit(&comp[v], avo, memory_order_relaxed);
+            p = avo;
+            avo = atomic_load_explicit(&comp[p], memory_order_relaxed);
+        }
+    }
+}
+
+static void *executarAfforest(void *argumento) {
+    ArgumentoAfforest *arg = (ArgumentoAfforest *)argumento;
+    EstadoAfforest *estado = arg->estado;
+    GrafoCSR *csr = estado->csr;
+    int n = csr->numVertices;
+    int inicio = (int)((long long)n * arg->id / estado->numThreads);
+    int fim = (int)((long long)n * (arg->id + 1) / estado->numThreads);
+
+    // Rodadas de vizinhos: liga cada vértice aos seus primeiros vizinhos
+    for (int r = 0; r < RODADAS_VIZINHOS_AFFOREST; r++) {
+        for (int v = inicio; v < fim; v++) {
+            long long e = csr->inicio[v] + r;
+            if (e < csr->inicio[v + 1]) {
+                unirAfforest(estado->comp, v, csr->destinos[e]);
+            }
+        }
+        pthread_barrier_wait(&estado->barreira);
+        comprimirAfforest(estado->comp, inicio, fim);
+        pthread_barrier_wait(&estado->barreira);
+    }
+
+    // Amostragem da componente mais frequente (provavelmente a gigante)
+    if (arg->id == 0) {
+        estado->componenteFrequente = -1;
+        if (estado->podePular && n > 0) {
+            int *amostras = (int *)malloc(AMOSTRAS_AFFOREST * sizeof(int));
+            if (!amostras) {
+                fprintf(stderr, "Erro ao alocar memória para as amostras\n");
+                exit(EXIT_FAILURE);
+            }
+            unsigned long long semente = 0x5eed;
+            for (int i = 0; i < AMOSTRAS_AFFOREST; i++) {
+                int v = (int)(proximoAleatorio(&semente) % (unsigned long long)n);
+                amostras[i] = atomic_load_explicit(&estado->comp[v], memory_order_relaxed);
+            }
+            qsort(amostras, AMOSTRAS_AFFOREST, sizeof(int), compararInteiros);
+            int melhor = amostras[0], contagemMelhor = 0, contagem = 0;
+            for (int i = 0; i < AMOSTRAS_AFFOREST; i++) {
+                contagem = (i > 0 && amostras[i] == amostras[i - 1]) ? contagem + 1 : 1;
+                if (contagem > contagemMelhor) {
+                    contagemMelhor = contagem;
+                    melhor = amostras[i];
+                }
+            }
+            estado->componenteFrequente = melhor;
+            free(amostras);
+        }
+    }
+    pthread_barrier_wait(&estado->barreira);
+
+    // Arestas restantes; vértices já na componente frequente são pulados
+    int frequente = estado->componenteFrequente;
+    for (int v = inicio; v < fim; v++) {
+        if (frequente != -1 && atomic_load_explicit(&estado->comp[v], memory_order_relaxed) == frequente) {
+            continue;
+        }
+        for (long long e = csr->inicio[v] + RODADAS_VIZINHOS_AFFOREST; e < csr->inicio[v + 1]; e++) {
+            unirAfforest(estado->comp, v, csr->destinos[e]);
+        }
+    }
+    pthread_barrier_wait(&estado->barreira);
+    comprimirAfforest(estado->comp, inicio, fim);
+    return NULL;
+}
+
+// As faixas de vértices e a barreira são divididas entre as threads efetivamente criadas
+static void prepararAfforest(void *contexto, int numThreads) {
+    EstadoAfforest *estado = (EstadoAfforest *)contexto;
+    estado->numThreads = numThreads;
+    pthread_barrier_init(&estado->barreira, NULL, (unsigned)numThreads);
+}
+
+// Variante paralela no estilo Afforest: liga poucos vizinhos por vértice, identifica a
+// componente gigante por amostragem e só processa as demais arestas fora dela
+void descobrirComponentesParalelo(Grafo *grafo, int *componentes, int *numComponentes, int numThreads) {
+    GrafoCSR *csr = obterCSR(grafo);
+    int n = csr->numVertices;
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+
+    EstadoAfforest estado;
+    estado.csr = csr;
+    estado.numThreads = numThreads;
+    estado.podePular = !grafo->direcionado;
+    estado.comp = (atomic_int *)malloc((size_t)n * sizeof(atomic_int));
+    if (!estado.comp) {
+        fprintf(stderr, "Erro ao alocar memória para as componentes\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        atomic_init(&estado.comp[v], v);
+    }
+
+    ArgumentoAfforest *argumentos = (ArgumentoAfforest *)malloc((size_t)numThreads * sizeof(ArgumentoAfforest));
+    if (!argumentos) {
+        fprintf(stderr, "Erro ao alocar memória para as threads\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int t = 0; t < numThreads; t++) {
+        argumentos[t].estado = &estado;
+        argumentos[t].id = t;
+    }
+    executarEmParalelo(numThreads, executarAfforest, argumentos, sizeof(ArgumentoAfforest), prepararAfforest, &estado);
+    pthread_barrier_destroy(&estado.barreira);
+    free(argumentos);
+
+    int *raizes = (int *)malloc((size_t)n * sizeof(int));
+    if (!raizes) {
+        fprintf(stderr, "Erro ao alocar memória para as componentes\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        raizes[v] = atomic_load(&estado.comp[v]);
+    }
+    rotularComponentes(n, raizes, componentes, numComponentes);
+
+    free(raizes);
+    free(estado.comp);
+}
+
+// Tarjan iterativo: cada quadro da pilha de chamadas guarda apenas o vértice, e o
+// cursor do próximo vizinho a visitar fica em um vetor contíguo indexado pelo vértice
+void componentesFortementeConexas(Grafo *grafo, int *componentes, int *numComponentes) {
+    GrafoCSR *csr = obterCSR(grafo);
+    int n = csr->numVertices;
+    int *indice = (int *)malloc((size_t)n * sizeof(int));
+    int *baixo = (int *)malloc((size_t)n * sizeof(int));
+    int *quadros = (int *)malloc((size_t)n * sizeof(int));
+    int *pilhaComponente = (int *)malloc((size_t)n * sizeof(int));
+    int *raizes = (int *)malloc((size_t)n * sizeof(int));
+    char *naPilha = (char *)calloc((size_t)n, sizeof(char));
+    long long *cursor = (long long *)malloc((size_t)n * sizeof(long long));
+    if (!indice || !baixo || !quadros || !pilhaComponente || !raizes || !naPilha || !cursor) {
+        fprintf(stderr, "Erro ao alocar memória para as componentes fortemente conexas\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        indice[v] = -1;
+    }
+
+    int contador = 0;
+    int topoComponente = -1;
+    for (int s = 0; s < n; s++) {
+        if (indice[s] != -1) {
+            continue;
+        }
+
+        int topo = 0;
+        quadros[0] = s;
+        indice[s] = baixo[s] = contador++;
+        cursor[s] = csr->inicio[s];
+        pilhaComponente[++topoComponente] = s;
+        naPilha[s] = 1;
+
+        while (topo >= 0) {
+            int v = quadros[topo];
+            if (cursor[v] < csr->inicio[v + 1]) {
+                int w = csr->destinos[cursor[v]++];
+                if (indice[w] == -1) {
+                    // "Chamada recursiva" para w
+                    quadros[++topo] = w;
+                    indice[w] = baixo[w] = contador++;
+                    cursor[w] = csr->inicio[w];
+                    pilhaComponente[++topoComponente] = w;
+                    naPilha[w] = 1;
+                } else if (naPilha[w] && indice[w] < baixo[v]) {
+                    baixo[v] = indice[w];
+                }
+                continue;
+            }
+
+            // Todos os vizinhos de v foram processados: "retorno" da chamada
+            topo--;
+            if (baixo[v] == indice[v]) {
+                int w;
+                do {
+                    w = pilhaComponente[topoComponente--];
+                    naPilha[w] = 0;
+                    raizes[w] = v;
+                } while (w != v);
+            }
+            if (topo >= 0) {
+                int u = quadros[topo];
+                if (baixo[v] < baixo[u]) {
+                    baixo[u] = baixo[v];
+                }
+            }
+        }
+    }
+
+    rotularComponentes(n, raizes, componentes, numComponentes);
+
+    free(indice);
+    free(baixo);
+    free(quadros);
+    free(pilhaComponente);
+    free(raizes);
+    free(naPilha);
+    free(cursor);
+}
+
+// Estado compartilhado da variante paralela (propagação de cores)
+typedef struct {
+    GrafoCSR *csr;
+    GrafoCSR *reverso;
+    atomic_int *cor;
+    atomic_char *naPilha; // Vértice presente em alguma pilha de propagação
+    int *raizes;          // Representante da componente de cada vértice (-1 se pendente)
+    int *pendentes;       // Vértices ainda sem componente
+    int numPendentes;
+    int *listaRaizes;
+    int numRaizes;
+    atomic_int proximaRaiz;
+    int numThreads;
+    pthread_barrier_t barreira;
+} EstadoScc;
+
+typedef struct {
+    EstadoScc *estado;
+    int id;
+} ArgumentoScc;
+
+// Pilha local de cada thread, que cresce sob demanda
+typedef struct {
+    int *dados;
+    int tamanho;
+    int capacidade;
+} PilhaLocal;
+
+static void empilharLocal(PilhaLocal *pilha, int v) {
+    if (pilha->tamanho == pilha->capacidade) {
+        pilha->capacidade *= 2;
+        pilha->dados = (int *)realloc(pilha->dados, (size_t)pilha->capacidade * sizeof(int));
+        if (!pilha->dados) {
+            fprintf(stderr, "Erro ao alocar memória para a pilha local\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    pilha->dados[pilha->tamanho++] = v;
+}
+
+// Atualiza alvo para max(alvo, valor); retorna 1 se o valor aumentou
+static int maximoAtomico(atomic_int *alvo, int valor) {
+    int atual = atomic_load(alvo);
+    while (valor > atual) {
+        if (atomic_compare_exchange_weak(alvo, &atual, valor)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void *executarSccParalelo(void *argumento) {
+    ArgumentoScc *arg = (ArgumentoScc *)argumento;
+    EstadoScc *estado = arg->estado;
+    GrafoCSR *csr = estado->csr;
+    GrafoCSR *reverso = estado->reverso;
+    PilhaLocal pilha;
+    pilha.tamanho = 0;
+    pilha.capacidade = 1024;
+    pilha.dados = (int *)malloc((size_t)pilha.capacidade * sizeof(int));
+    if (!pilha.dados) {
+        fprintf(stderr, "Erro ao alocar memória para a pilha local\n");
+        exit(EXIT_FAILURE);
+    }
+
+    while (estado->numPendentes > 0) {
+        int inicio = (int)((long long)estado->numPendentes * arg->id / estado->numThreads);
+        int fim = (int)((long long)estado->numPendentes * (arg->id + 1) / estado->numThreads);
+
+        // Cada vértice pendente começa com a própria cor
+        for (int i = inicio; i < fim; i++) {
+            int v = estado->pendentes[i];
+            atomic_store(&estado->cor[v], v);
+            atomic_store(&estado->naPilha[v], 1);
+            empilharLocal(&pilha, v);
+        }
+        pthread_barrier_wait(&estado->barreira);
+
+        // Propaga a maior cor ao longo das arestas de forma assíncrona: quem aumenta a cor
+        // de um vértice o empilha (se ainda não estiver em alguma pilha), e o ponto fixo é
+        // atingido quando todas as pilhas esvaziam
+        while (pilha.tamanho > 0) {
+            int u = pilha.dados[--pilha.tamanho];
+            atomic_store(&estado->naPilha[u], 0);
+            int corU = atomic_load(&estado->cor[u]);
+            for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+                int v = csr->destinos[e];
+                if (estado->raizes[v] != -1) {
+                    continue;
+                }
+                if (maximoAtomico(&estado->cor[v], corU) && !atomic_exchange(&estado->naPilha[v], 1)) {
+                    empilharLocal(&pilha, v);
+                }
+            }
+        }
+        pthread_barrier_wait(&estado->barreira);
+
+        // Raízes: vértices que mantiveram a própria cor
+        if (arg->id == 0) {
+            estado->numRaizes = 0;
+            for (int i = 0; i < estado->numPendentes; i++) {
+                int v = estado->pendentes[i];
+                if (atomic_load_explicit(&estado->cor[v], memory_order_relaxed) == v) {
+                    estado->listaRaizes[estado->numRaizes++] = v;
+                }
+            }
+            atomic_store(&estado->proximaRaiz, 0);
+        }
+        pthread_barrier_wait(&estado->barreira);
+
+        // Busca para trás a partir de cada raiz, restrita aos vértices da mesma cor:
+        // os vértices alcançados formam a componente da raiz
+        while (1) {
+            int i = atomic_fetch_add(&estado->proximaRaiz, 1);
+            if (i >= estado->numRaizes) {
+                break;
+            }
+            int raiz = estado->listaRaizes[i];
+            pilha.tamanho = 0;
+            empilharLocal(&pilha, raiz);
+            estado->raizes[raiz] = raiz;
+            while (pilha.tamanho > 0) {
+                int v = pilha.dados[--pilha.tamanho];
+                for (long long e = reverso->inicio[v]; e < reverso->inicio[v + 1]; e++) {
+                    int u = reverso->destinos[e];
+                    // A cor é testada primeiro: só esta thread toca os vértices da cor da raiz
+                    if (atomic_load_explicit(&estado->cor[u], memory_order_relaxed) != raiz ||
+                        estado->raizes[u] != -1) {
+                        continue;
+                    }
+                    estado->raizes[u] = raiz;
+                    empilharLocal(&pilha, u);
+                }
+            }
+        }
+        pilha.tamanho = 0;
+        pthread_barrier_wait(&estado->barreira);
+
+        // Compacta a lista de pendentes para a próxima rodada
+        if (arg->id == 0) {
+            int restantes = 0;
+            for (int i = 0; i < estado->numPendentes; i++) {
+                if (estado->raizes[estado->pendentes[i]] == -1) {
+                    estado->pendentes[restantes++] = estado->pendentes[i];
+                }
+            }
+            estado->numPendentes = restantes;
+        }
+        pthread_barrier_wait(&estado->barreira);
+    }
+
+    free(pilha.dados);
+    return NULL;
+}
+
+// Remove iterativamente vértices sem arestas de entrada ou de saída entre os pendentes:
+// cada um é sozinho a sua componente
+static void podarVerticesTriviais(GrafoCSR *csr, GrafoCSR *reverso, int *raizes) {
+    int n = csr->numVertices;
+    int *grauEntrada = (int *)malloc((size_t)n * sizeof(int));
+    int *grauSaida = (int *)malloc((size_t)n * sizeof(int));
+    int *fila = (int *)malloc((size_t)n * sizeof(int));
+    if (!grauEntrada || !grauSaida || !fila) {
+        fprintf(stderr, "Erro ao alocar memória para a poda\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int frente = 0, tras = 0;
+    for (int v = 0; v < n; v++) {
+        grauSaida[v] = (int)(csr->inicio[v + 1] - csr->inicio[v]);
+        grauEntrada[v] = (int)(reverso->inicio[v + 1] - reverso->inicio[v]);
+        if (grauEntrada[v] == 0 || grauSaida[v] == 0) {
+            raizes[v] = v;
+            fila[tras++] = v;
+        }
+    }
+    while (frente < tras) {
+        int v = fila[frente++];
+        for (long long e = csr->inicio[v]; e < csr->inicio[v + 1]; e++) {
+            int w = csr->destinos[e];
+            if (raizes[w] == -1 && --grauEntrada[w] == 0) {
+                raizes[w] = w;
+                fila[tras++] = w;
+            }
+        }
+        for (long long e = reverso->inicio[v]; e < reverso->inicio[v + 1]; e++) {
+            int w = reverso->destinos[e];
+            if (raizes[w] == -1 && --grauSaida[w] == 0) {
+                raizes[w] = w;
+                fila[tras++] = w;
+            }
+        }
+    }
+
+    free(grauEntrada);
+    free(grauSaida);
+    free(fila);
+}
+
+// Os vértices pendentes e a barreira são divididos entre as threads efetivamente criadas
+static void prepararSccParalelo(void *contexto, int numThreads) {
+    EstadoScc *estado = (EstadoScc *)contexto;
+    estado->numThreads = numThreads;
+    pthread_barrier_init(&estado->barreira, NULL, (unsigned)numThreads);
+}
+
+void componentesFortementeConexasParalelo(Grafo *grafo, int *componentes, int *numComponentes, int numThreads) {
+    GrafoCSR *csr = obterCSR(grafo);
+    GrafoCSR *reverso = obterCSRReverso(grafo);
+    int n = csr->numVertices;
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+
+    EstadoScc estado;
+    estado.csr = csr;
+    estado.reverso = reverso;
+    estado.numThreads = numThreads;
+    estado.cor = (atomic_int *)malloc((size_t)n * sizeof(atomic_int));
+    estado.naPilha = (atomic_char *)malloc((size_t)n * sizeof(atomic_char));
+    estado.raizes = (int *)malloc((size_t)n * sizeof(int));
+    estado.pendentes = (int *)malloc((size_t)n * sizeof(int));
+    estado.listaRaizes = (int *)malloc((size_t)n * sizeof(int));
+    if (!estado.cor || !estado.naPilha || !estado.raizes || !estado.pendentes || !estado.listaRaizes) {
+        fprintf(stderr, "Erro ao alocar memória para as componentes fortemente conexas\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        atomic_init(&estado.cor[v], v);
+        atomic_init(&estado.naPilha[v], 0);
+        estado.raizes[v] = -1;
+    }
+    atomic_init(&estado.proximaRaiz, 0);
+
+    podarVerticesTriviais(csr, reverso, estado.raizes);
+
+    estado.numPendentes = 0;
+    for (int v = 0; v < n; v++) {
+        if (estado.raizes[v] == -1) {
+            estado.pendentes[estado.numPendentes++] = v;
+        }
+    }
+
+    if (estado.numPendentes > 0) {
+        ArgumentoScc *argumentos = (ArgumentoScc *)malloc((size_t)numThreads * sizeof(ArgumentoScc));
+        if (!argumentos) {
+            fprintf(stderr, "Erro ao alocar memória para as threads\n");
+            exit(EXIT_FAILURE);
+        }
+        for (int t = 0; t < numThreads; t++) {
+            argumentos[t].estado = &estado;
+            argumentos[t].id = t;
+        }
+        executarEmParalelo(numThreads, executarSccParalelo, argumentos, sizeof(ArgumentoScc), prepararSccParalelo, &estado);
+        pthread_barrier_destroy(&estado.barreira);
+        free(argumentos);
+    }
+
+    rotularComponentes(n, estado.raizes, componentes, numComponentes);
+
+    free(estado.cor);
+    free(estado.naPilha);
+    free(estado.raizes);
+    free(estado.pendentes);
+    free(estado.listaRaizes);
+}
+
+Grafo *criarGrafoCondensado(Grafo *grafo, const int *componentes, int numComponentes, TipoRepresentacao tipo) {
+    GrafoCSR *csr = obterCSR(grafo);
+    BufferArestas *arestas = criarBufferArestas(numComponentes);
+
+    for (int u = 0; u < csr->numVertices; u++) {
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int cu = componentes[u] - 1;
+            int cv = componentes[csr->destinos[e]] - 1;
+            if (cu != cv) {
+                inserirArestaBuffer(arestas, cu, cv, csr->pesos[e]);
+            }
+        }
+    }
+
+    // Funde os arcos paralelos entre o mesmo par de componentes
+    normalizarArestas(arestas, numComponentes, 1);
+    Grafo *condensado = construirGrafoDeArestas(arestas, numComponentes, tipo, 1);
+    liberarBufferArestas(arestas);
+    return condensado;
+}
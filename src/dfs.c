@@ -0,0 +1,139 @@
+#include "../include/dfs.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+// Quadro da pilha da DFS: vértice e posição do próximo vizinho a examinar
+typedef struct {
+    int vertice;
+    long long cursor;
+} QuadroDfs;
+
+static ResultadoDfs *criarResultadoDfs(int numVertices, long long numArestas) {
+    ResultadoDfs *resultado = (ResultadoDfs *)malloc(sizeof(ResultadoDfs));
+    if (!resultado) {
+        fprintf(stderr, "Erro ao alocar memória para o resultado da DFS\n");
+        exit(EXIT_FAILURE);
+    }
+    resultado->numVertices = numVertices;
+    resultado->numVisitados = 0;
+    resultado->pais = (int *)malloc((size_t)numVertices * sizeof(int));
+    resultado->niveis = (int *)malloc((size_t)numVertices * sizeof(int));
+    resultado->descoberta = (int *)malloc((size_t)numVertices * sizeof(int));
+    resultado->finalizacao = (int *)malloc((size_t)numVertices * sizeof(int));
+    resultado->ordemFinalizacao = (int *)malloc((size_t)numVertices * sizeof(int));
+    resultado->tiposArestas = (unsigned char *)malloc((size_t)numArestas + 1);
+    if (!resultado->pais || !resultado->niveis || !resultado->descoberta || !resultado->finalizacao ||
+        !resultado->ordemFinalizacao || !resultado->tiposArestas) {
+        fprintf(stderr, "Erro ao alocar memória para o resultado da DFS\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < numVertices; v++) {
+        resultado->pais[v] = -1;
+        resultado->niveis[v] = -1;
+        resultado->descoberta[v] = -1;
+        resultado->finalizacao[v] = -1;
+    }
+    return resultado;
+}
+
+void liberarResultadoDfs(ResultadoDfs *resultado) {
+    free(resultado->pais);
+    free(resultado->niveis);
+    free(resultado->descoberta);
+    free(resultado->finalizacao);
+    free(resultado->ordemFinalizacao);
+    free(resultado->tiposArestas);
+    free(resultado);
+}
+
+// Percorre a árvore da DFS enraizada em raiz, continuando o relógio em *tempo
+static void explorarDfs(GrafoCSR *csr, int direcionado, int raiz, ResultadoDfs *resultado, QuadroDfs *pilha,
+                        char *arestaPaiUsada, int *tempo) {
+    int topo = 0;
+    pilha[0].vertice = raiz;
+    pilha[0].cursor = csr->inicio[raiz];
+    resultado->descoberta[raiz] = (*tempo)++;
+    resultado->niveis[raiz] = 0;
+    arestaPaiUsada[raiz] = 0;
+
+    while (topo >= 0) {
+        QuadroDfs *quadro = &pilha[topo];
+        int u = quadro->vertice;
+
+        if (quadro->cursor == csr->inicio[u + 1]) {
+            // Todos os vizinhos examinados: finaliza u e retorna ao quadro anterior
+            resultado->finalizacao[u] = (*tempo)++;
+            resultado->ordemFinalizacao[resultado->numVisitados++] = u;
+            topo--;
+            continue;
+        }
+
+        long long e = quadro->cursor++;
+        int v = csr->destinos[e];
+        if (resultado->descoberta[v] == -1) {
+            resultado->tiposArestas[e] = ARESTA_ARVORE;
+            resultado->pais[v] = u;
+            resultado->niveis[v] = resultado->niveis[u] + 1;
+            resultado->descoberta[v] = (*tempo)++;
+            arestaPaiUsada[v] = 0;
+            topo++;
+            pilha[topo].vertice = v;
+            pilha[topo].cursor = csr->inicio[v];
+        } else if (!direcionado) {
+            // A primeira cópia da aresta até o pai é o espelho da aresta de árvore
+            if (v == resultado->pais[u] && !arestaPaiUsada[u]) {
+                arestaPaiUsada[u] = 1;
+                resultado->tiposArestas[e] = ARESTA_ARVORE;
+            } else {
+                resultado->tiposArestas[e] = ARESTA_RETORNO;
+            }
+        } else if (resultado->finalizacao[v] == -1) {
+            resultado->tiposArestas[e] = ARESTA_RETORNO;
+        } else if (resultado->descoberta[u] < resultado->descoberta[v]) {
+            resultado->tiposArestas[e] = ARESTA_AVANCO;
+        } else {
+            resultado->tiposArestas[e] = ARESTA_CRUZAMENTO;
+        }
+    }
+}
+
+ResultadoDfs *dfsIterativa(Grafo *grafo, int verticeInicial) {
+    GrafoCSR *csr = obterCSR(grafo);
+    int n = csr->numVertices;
+    ResultadoDfs *resultado = criarResultadoDfs(n, csr->numArestas);
+    if (verticeInicial >= n) {
+        printf("Vértice inicial inválido: %d.\n", verticeInicial + 1);
+        return resultado;
+    }
+
+    QuadroDfs *pilha = (QuadroDfs *)malloc((size_t)(n > 0 ? n : 1) * sizeof(QuadroDfs));
+    char *arestaPaiUsada = (char *)malloc((size_t)(n > 0 ? n : 1));
+    if (!pilha || !arestaPaiUsada) {
+        fprintf(stderr, "Erro ao alocar memória para a pilha da DFS\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int tempo = 0;
+    if (verticeInicial >= 0) {
+        explorarDfs(csr, grafo->direcionado, verticeInicial, resultado, pilha, arestaPaiUsada, &tempo);
+    } else {
+        for (int v = 0; v < n; v++) {
+            if (resultado->descoberta[v] == -1) {
+                explorarDfs(csr, grafo->direcionado, v, resultado, pilha, arestaPaiUsada, &tempo);
+            }
+        }
+    }
+
+    // Arestas que partem de vértices não alcançados ficam como cruzamento
+    for (int u = 0; u < n; u++) {
+        if (resultado->descoberta[u] == -1) {
+            for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+                resultado->tiposArestas[e] = ARESTA_CRUZAMENTO;
+            }
+        }
+    }
+
+    free(pilha);
+    free(arestaPaiUsada);
+    return resultado;
+}
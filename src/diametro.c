@@ -0,0 +1,321 @@
+#include "../include/diametro.h"
+#include "../include/componentes.h"
+#include "../include/gerador.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+// Objetivo da poda: quais vértices ainda precisam ser considerados
+typedef enum { OBJETIVO_DIAMETRO_RAIO, OBJETIVO_EXCENTRICIDADES } ObjetivoExcentricidade;
+
+// Estado compartilhado entre as buscas
+typedef struct {
+    GrafoCSR *csr;
+    GrafoCSR *reverso;       // NULL em grafos não direcionados (distâncias simétricas)
+    int *componentes;
+    int *inferior;           // Limite inferior da excentricidade de cada vértice
+    int *superior;           // Limite superior da excentricidade de cada vértice
+    int *distancia;          // Distâncias da última BFS (-1 = não alcançado)
+    int *distanciaReversa;   // Distâncias até a origem (somente grafos direcionados)
+    int *fila;
+    int *filaReversa;
+    int numBuscas;
+} EstadoDiametro;
+
+// BFS sobre o CSR a partir de origem. Retorna quantos vértices foram alcançados; a fila
+// guarda esses vértices em ordem, e o último deles é o mais distante.
+static int bfsDistancias(GrafoCSR *csr, int origem, int *distancia, int *fila) {
+    int frente = 0, tras = 0;
+    fila[tras++] = origem;
+    distancia[origem] = 0;
+    while (frente < tras) {
+        int u = fila[frente++];
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int v = csr->destinos[e];
+            if (distancia[v] == -1) {
+                distancia[v] = distancia[u] + 1;
+                fila[tras++] = v;
+            }
+        }
+    }
+    return tras;
+}
+
+// Limpa somente os vértices alcançados pela última busca
+static void limparDistancias(int *distancia, const int *fila, int alcancados) {
+    for (int i = 0; i < alcancados; i++) {
+        distancia[fila[i]] = -1;
+    }
+}
+
+// Executa a BFS a partir de w e atualiza os limites dos vértices. Para v na mesma
+// componente de w (os dois se alcançam e alcançam os mesmos vértices):
+//   max(d(v,w), exc(w) - d(w,v)) <= exc(v) <= d(v,w) + exc(w)
+// e para qualquer v que alcance w vale exc(v) >= d(v,w). Retorna o vértice mais distante.
+static int processarOrigem(EstadoDiametro *estado, int w) {
+    int alcancados = bfsDistancias(estado->csr, w, estado->distancia, estado->fila);
+    int maisDistante = estado->fila[alcancados - 1];
+    int excentricidade = estado->distancia[maisDistante];
+    estado->numBuscas++;
+
+    int *paraOrigem = estado->distancia;
+    int *filaParaOrigem = estado->fila;
+    int alcancadosReverso = alcancados;
+    if (estado->reverso != NULL) {
+        alcancadosReverso = bfsDistancias(estado->reverso, w, estado->distanciaReversa, estado->filaReversa);
+        paraOrigem = estado->distanciaReversa;
+        filaParaOrigem = estado->filaReversa;
+    }
+
+    for (int i = 0; i < alcancadosReverso; i++) {
+        int v = filaParaOrigem[i];
+        int dvw = paraOrigem[v];
+        if (dvw > estado->inferior[v]) {
+            estado->inferior[v] = dvw;
+        }
+        if (estado->componentes[v] != estado->componentes[w]) {
+            continue;
+        }
+        int dwv = estado->distancia[v];
+        if (excentricidade - dwv > estado->inferior[v]) {
+            estado->inferior[v] = excentricidade - dwv;
+        }
+        if (dvw + excentricidade < estado->superior[v]) {
+            estado->superior[v] = dvw + excentricidade;
+        }
+    }
+    estado->inferior[w] = estado->superior[w] = excentricidade;
+
+    limparDistancias(estado->distancia, estado->fila, alcancados);
+    if (estado->reverso != NULL) {
+        limparDistancias(estado->distanciaReversa, estado->filaReversa, alcancadosReverso);
+    }
+    return maisDistante;
+}
+
+static EstadoDiametro *criarEstadoDiametro(Grafo *grafo) {
+    EstadoDiametro *estado = (EstadoDiametro *)malloc(sizeof(EstadoDiametro));
+    if (!estado) {
+        fprintf(stderr, "Erro ao alocar memória para o cálculo do diâmetro\n");
+        exit(EXIT_FAILURE);
+    }
+    estado->csr = obterCSR(grafo);
+    estado->reverso = grafo->direcionado ? obterCSRReverso(grafo) : NULL;
+    int n = estado->csr->numVertices;
+
+    estado->componentes = (int *)malloc((size_t)n * sizeof(int));
+    estado->inferior = (int *)malloc((size_t)n * sizeof(int));
+    estado->superior = (int *)malloc((size_t)n * sizeof(int));
+    estado->distancia = (int *)malloc((size_t)n * sizeof(int));
+    estado->fila = (int *)malloc((size_t)n * sizeof(int));
+    estado->distanciaReversa = NULL;
+    estado->filaReversa = NULL;
+    if (estado->reverso != NULL) {
+        estado->distanciaReversa = (int *)malloc((size_t)n * sizeof(int));
+        estado->filaReversa = (int *)malloc((size_t)n * sizeof(int));
+    }
+    if (!estado->componentes || !estado->inferior || !estado->superior || !estado->distancia || !estado->fila ||
+        (estado->reverso != NULL && (!estado->distanciaReversa || !estado->filaReversa))) {
+        fprintf(stderr, "Erro ao alocar memória para o cálculo do diâmetro\n");
+        exit(EXIT_FAILURE);
+    }
+    estado->numBuscas = 0;
+
+    int numComponentes;
+    if (grafo->direcionado) {
+        componentesFortementeConexas(grafo, estado->componentes, &numComponentes);
+    } else {
+        descobrirComponentesUnionFind(grafo, estado->componentes, &numComponentes);
+    }
+
+    // O limite superior inicial é o tamanho da componente menos um (não direcionado);
+    // em grafos direcionados o alcance pode sair da componente, então vale n - 1.
+    // Vértices sem arestas de saída têm excentricidade zero.
+    int *tamanhos = (int *)calloc((size_t)numComponentes + 1, sizeof(int));
+    if (!tamanhos) {
+        fprintf(stderr, "Erro ao alocar memória para o cálculo do diâmetro\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        tamanhos[estado->componentes[v]]++;
+    }
+    for (int v = 0; v < n; v++) {
+        estado->distancia[v] = -1;
+        if (estado->reverso != NULL) {
+            estado->distanciaReversa[v] = -1;
+        }
+        estado->inferior[v] = 0;
+        if (estado->csr->inicio[v + 1] == estado->csr->inicio[v]) {
+            estado->superior[v] = 0;
+        } else {
+            estado->superior[v] = grafo->direcionado ? n - 1 : tamanhos[estado->componentes[v]] - 1;
+        }
+    }
+    free(tamanhos);
+    return estado;
+}
+
+static void liberarEstadoDiametro(EstadoDiametro *estado) {
+    free(estado->componentes);
+    free(estado->inferior);
+    free(estado->superior);
+    free(estado->distancia);
+    free(estado->fila);
+    free(estado->distanciaReversa);
+    free(estado->filaReversa);
+    free(estado);
+}
+
+// Limites globais: diâmetro em [max inferior, max superior], raio em [min inferior, min superior]
+static LimitesDiametro resumirLimites(EstadoDiametro *estado) {
+    LimitesDiametro limites = {0, 0, 0, 0, estado->numBuscas};
+    int n = estado->csr->numVertices;
+    for (int v = 0; v < n; v++) {
+        if (estado->inferior[v] > limites.diametroInferior) {
+            limites.diametroInferior = estado->inferior[v];
+        }
+        if (estado->superior[v] > limites.diametroSuperior) {
+            limites.diametroSuperior = estado->superior[v];
+        }
+        if (v == 0 || estado->inferior[v] < limites.raioInferior) {
+            limites.raioInferior = estado->inferior[v];
+        }
+        if (v == 0 || estado->superior[v] < limites.raioSuperior) {
+            limites.raioSuperior = estado->superior[v];
+        }
+    }
+    return limites;
+}
+
+// Vértice de maior grau (ponto de partida da varredura dupla)
+static int verticeMaiorGrau(GrafoCSR *csr) {
+    int melhor = 0;
+    for (int v = 1; v < csr->numVertices; v++) {
+        if (csr->inicio[v + 1] - csr->inicio[v] > csr->inicio[melhor + 1] - csr->inicio[melhor]) {
+            melhor = v;
+        }
+    }
+    return melhor;
+}
+
+// Laço de poda: enquanto houver candidatos, alterna entre o de maior limite superior
+// (que pode aumentar o diâmetro) e o de menor limite inferior (que pode diminuir o raio),
+// desempatando pelo maior grau
+static void podarPorLimites(EstadoDiametro *estado, ObjetivoExcentricidade objetivo) {
+    GrafoCSR *csr = estado->csr;
+    int n = csr->numVertices;
+    int *candidatos = (int *)malloc((size_t)n * sizeof(int));
+    if (!candidatos) {
+        fprintf(stderr, "Erro ao alocar memória para os candidatos\n");
+        exit(EXIT_FAILURE);
+    }
+    int numCandidatos = n;
+    for (int v = 0; v < n; v++) {
+        candidatos[v] = v;
+    }
+
+    int escolherSuperior = 1;
+    int diametroInferior = 0, raioSuperior = n;
+    while (1) {
+        for (int i = 0; i < numCandidatos; i++) {
+            int v = candidatos[i];
+            if (estado->inferior[v] > diametroInferior) {
+                diametroInferior = estado->inferior[v];
+            }
+            if (estado->superior[v] < raioSuperior) {
+                raioSuperior = estado->superior[v];
+            }
+        }
+
+        // Remove os vértices resolvidos ou que não podem alterar o resultado
+        int restantes = 0;
+        for (int i = 0; i < numCandidatos; i++) {
+            int v = candidatos[i];
+            int ativo;
+            if (objetivo == OBJETIVO_EXCENTRICIDADES) {
+                ativo = estado->inferior[v] < estado->superior[v];
+            } else {
+                ativo = estado->inferior[v] < estado->superior[v] &&
+                        (estado->superior[v] > diametroInferior || estado->inferior[v] < raioSuperior);
+            }
+            if (ativo) {
+                candidatos[restantes++] = v;
+            }
+        }
+        numCandidatos = restantes;
+        if (numCandidatos == 0) {
+            break;
+        }
+
+        int escolhido = candidatos[0];
+        for (int i = 1; i < numCandidatos; i++) {
+            int v = candidatos[i];
+            long long grauV = csr->inicio[v + 1] - csr->inicio[v];
+            long long grauEscolhido = csr->inicio[escolhido + 1] - csr->inicio[escolhido];
+            int chaveV = escolherSuperior ? estado->superior[v] : -estado->inferior[v];
+            int chaveEscolhido = escolherSuperior ? estado->superior[escolhido] : -estado->inferior[escolhido];
+            if (chaveV > chaveEscolhido || (chaveV == chaveEscolhido && grauV > grauEscolhido)) {
+                escolhido = v;
+            }
+        }
+        processarOrigem(estado, escolhido);
+        escolherSuperior = !escolherSuperior;
+    }
+
+    free(candidatos);
+}
+
+LimitesDiametro calcularDiametroRaio(Grafo *grafo) {
+    LimitesDiametro limites = {0, 0, 0, 0, 0};
+    if (grafo->numVertices == 0) {
+        return limites;
+    }
+    EstadoDiametro *estado = criarEstadoDiametro(grafo);
+
+    // Varredura dupla: o vértice mais distante do de maior grau é um bom candidato a
+    // extremo do diâmetro e fornece um limite inferior forte logo no início
+    int extremo = processarOrigem(estado, verticeMaiorGrau(estado->csr));
+    processarOrigem(estado, extremo);
+    podarPorLimites(estado, OBJETIVO_DIAMETRO_RAIO);
+
+    limites = resumirLimites(estado);
+    liberarEstadoDiametro(estado);
+    return limites;
+}
+
+LimitesDiametro estimarDiametroRaio(Grafo *grafo, int numAmostras, unsigned long long semente) {
+    LimitesDiametro limites = {0, 0, 0, 0, 0};
+    int n = grafo->numVertices;
+    if (n == 0) {
+        return limites;
+    }
+    EstadoDiametro *estado = criarEstadoDiametro(grafo);
+
+    int extremo = processarOrigem(estado, verticeMaiorGrau(estado->csr));
+    processarOrigem(estado, extremo);
+    for (int i = 0; i < numAmostras; i++) {
+        processarOrigem(estado, (int)(proximoAleatorio(&semente) % (unsigned long long)n));
+    }
+
+    limites = resumirLimites(estado);
+    liberarEstadoDiametro(estado);
+    return limites;
+}
+
+int calcularExcentricidades(Grafo *grafo, int *excentricidades) {
+    int n = grafo->numVertices;
+    if (n == 0) {
+        return 0;
+    }
+    EstadoDiametro *estado = criarEstadoDiametro(grafo);
+
+    int extremo = processarOrigem(estado, verticeMaiorGrau(estado->csr));
+    processarOrigem(estado, extremo);
+    podarPorLimites(estado, OBJETIVO_EXCENTRICIDADES);
+
+    for (int v = 0; v < n; v++) {
+        excentricidades[v] = estado->inferior[v];
+    }
+    int numBuscas = estado->numBuscas;
+    liberarEstadoDiametro(estado);
+    return numBuscas;
+}
@@ -0,0 +1,79 @@
+#include "../include/execucao_paralela.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+// Portão que segura as threads auxiliares até o número efetivo de threads ser conhecido
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t condicao;
+    int liberada;
+    void *(*funcao)(void *);
+} PartidaThreads;
+
+typedef struct {
+    PartidaThreads *partida;
+    void *argumento;
+} ArgumentoPartida;
+
+static void *aguardarPartida(void *argumento) {
+    ArgumentoPartida *arg = (ArgumentoPartida *)argumento;
+    PartidaThreads *partida = arg->partida;
+    pthread_mutex_lock(&partida->mutex);
+    while (!partida->liberada) {
+        pthread_cond_wait(&partida->condicao, &partida->mutex);
+    }
+    pthread_mutex_unlock(&partida->mutex);
+    return partida->funcao(arg->argumento);
+}
+
+int executarEmParalelo(int numThreads, void *(*funcao)(void *), void *argumentos, size_t tamanhoArgumento,
+                       void (*preparar)(void *contexto, int numThreads), void *contexto) {
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+    pthread_t *threads = (pthread_t *)malloc((size_t)numThreads * sizeof(pthread_t));
+    ArgumentoPartida *partidas = (ArgumentoPartida *)malloc((size_t)numThreads * sizeof(ArgumentoPartida));
+    if (!threads || !partidas) {
+        fprintf(stderr, "Erro ao alocar memória para as threads\n");
+        exit(EXIT_FAILURE);
+    }
+
+    PartidaThreads partida;
+    pthread_mutex_init(&partida.mutex, NULL);
+    pthread_cond_init(&partida.condicao, NULL);
+    partida.liberada = 0;
+    partida.funcao = funcao;
+
+    int criadas = 1;
+    for (int t = 1; t < numThreads; t++) {
+        partidas[t].partida = &partida;
+        partidas[t].argumento = (char *)argumentos + (size_t)t * tamanhoArgumento;
+        int erro = pthread_create(&threads[t], NULL, aguardarPartida, &partidas[t]);
+        if (erro != 0) {
+            printf("Erro ao criar a thread %d (%s); continuando com %d thread(s)\n", t, strerror(erro), criadas);
+            break;
+        }
+        criadas++;
+    }
+
+    if (preparar != NULL) {
+        preparar(contexto, criadas);
+    }
+    pthread_mutex_lock(&partida.mutex);
+    partida.liberada = 1;
+    pthread_cond_broadcast(&partida.condicao);
+    pthread_mutex_unlock(&partida.mutex);
+
+    funcao(argumentos);
+    for (int t = 1; t < criadas; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    pthread_cond_destroy(&partida.condicao);
+    pthread_mutex_destroy(&partida.mutex);
+    free(threads);
+    free(partidas);
+    return criadas;
+}
@@ -0,0 +1,28 @@
+#include "../include/gerador.h"
+#include <stdlib.h>
+
+// Gerador pseudoaleatório splitmix64
+unsigned long long proximoAleatorio(unsigned long long *estado) {
+    unsigned long long z = (*estado += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// Gera um grafo com numArestas arestas (u, v) sorteadas uniformemente
+Grafo *gerarGrafoSintetico(int numVertices, long long numArestas, int capacidadeMaxima,
+                           unsigned long long semente, TipoRepresentacao tipo, int direcionado) {
+    Grafo *grafo = criarGrafo(numVertices, tipo, direcionado);
+    unsigned long long estado = semente;
+    if (capacidadeMaxima < 1) {
+        capacidadeMaxima = 1;
+    }
+
+    for (long long i = 0; i < numArestas; i++) {
+        int u = (int)(proximoAleatorio(&estado) % (unsigned long long)numVertices);
+        int v = (int)(proximoAleatorio(&estado) % (unsigned long long)numVertices);
+        double capacidade = (double)(1 + proximoAleatorio(&estado) % (unsigned long long)capacidadeMaxima);
+        adicionarArestaGrafo(grafo, u, v, capacidade, direcionado);
+    }
+    return grafo;
+}
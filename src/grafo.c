@@ -1,7 +1,12 @@
 #include "../include/grafo.h"
+#include "../include/leitura.h"
+#include "../include/componentes.h"
+#include "../include/kernels_vetor.h"
+#include "../include/caminhos_minimos.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <float.h>
+#include <string.h>
 
 Grafo *criarGrafo(int numVertices, TipoRepresentacao tipo, int direcionado) {
     Grafo *grafo = (Grafo *)malloc(sizeof(Grafo));
@@ -9,6 +14,9 @@ Grafo *criarGrafo(int numVertices, TipoRepresentacao tipo, int direcionado) {
     grafo->numArestas = 0;
     grafo->tipo = tipo;
     grafo->direcionado = direcionado;
+    grafo->mapaIds = NULL;
+    grafo->csr = NULL;
+    grafo->csrReverso = NULL;
 
     if (tipo == MATRIZ_ADJACENCIA) {
         grafo->grafoMatriz = criarGrafoMatriz(numVertices);
@@ -27,6 +35,9 @@ Grafo *criarGrafoVazio(int numVertices, TipoRepresentacao tipo) {
     grafo->numArestas = 0;
     grafo->tipo = tipo;
     grafo->direcionado = 0; // Por padrão, grafos vazios são não direcionados
+    grafo->mapaIds = NULL;
+    grafo->csr = NULL;
+    grafo->csrReverso = NULL;
 
     if (tipo == MATRIZ_ADJACENCIA) {
         grafo->grafoMatriz = criarGrafoMatriz(numVertices);
@@ -38,17 +49,20 @@ Grafo *criarGrafoVazio(int numVertices, TipoRepresentacao tipo) {
     return grafo;
 }
 
-// Função para ler as arestas do arquivo e preencher o grafo
-void lerArestas(Grafo *grafo, const char *nomeArquivo, int direcionado) {
+// Função para ler as arestas do arquivo e preencher o grafo. As arestas passam pela
+// normalização (laços removidos e arestas paralelas fundidas) antes de serem inseridas;
+// retorna o número de arestas removidas, ou -1 em caso de erro.
+long long lerArestas(Grafo *grafo, const char *nomeArquivo, int direcionado) {
     FILE *arquivo = fopen(nomeArquivo, "r");
     if (!arquivo) {
         printf("Erro ao abrir o arquivo.\n");
-        return;
+        return -1;
     }
 
     int numVertices;
     fscanf(arquivo, "%d", &numVertices); // Ignora o número de vértices, pois já foi lido
 
+    BufferArestas *arestas = criarBufferArestas(grafo->numVertices);
     int u, v;
     double capacidade;
     while (fscanf(arquivo, "%d %d %lf", &u, &v, &capacidade) == 3) {
@@ -56,11 +70,24 @@ void lerArestas(Grafo *grafo, const char *nomeArquivo, int direcionado) {
         u -= 1;
         v -= 1;
 
-        // Adiciona a aresta
-        adicionarArestaGrafo(grafo, u, v, capacidade, direcionado);
+        if (u < 0 || u >= grafo->numVertices || v < 0 || v >= grafo->numVertices) {
+            printf("Aresta (%d, %d) ignorada: vértice fora do intervalo 1..%d.\n", u + 1, v + 1, grafo->numVertices);
+            continue;
+        }
+        inserirArestaBuffer(arestas, u, v, capacidade);
     }
 
     fclose(arquivo);
+
+    long long removidas = normalizarArestas(arestas, grafo->numVertices, direcionado);
+
+    // Adiciona as arestas
+    for (long long i = 0; i < arestas->numArestas; i++) {
+        adicionarArestaGrafo(grafo, arestas->origens[i], arestas->destinos[i], arestas->capacidades[i], direcionado);
+    }
+
+    liberarBufferArestas(arestas);
+    return removidas;
 }
 
 void liberarGrafo(Grafo *grafo) {
@@ -69,6 +96,10 @@ void liberarGrafo(Grafo *grafo) {
     } else if (grafo->tipo == LISTA_ADJACENCIA) {
         liberarGrafoLista(grafo->grafoLista);
     }
+    if (grafo->mapaIds != NULL) {
+        liberarMapaVertices(grafo->mapaIds);
+    }
+    invalidarCSR(grafo);
     free(grafo);
 }
 
@@ -76,7 +107,7 @@ void liberarGrafo(Grafo *grafo) {
 EstatisticasGrafo *calcularEstatisticasGrafo(Grafo *grafo) {
     EstatisticasGrafo *stats = (EstatisticasGrafo *)malloc(sizeof(EstatisticasGrafo));
     int *graus = (int *)malloc(grafo->numVertices * sizeof(int));
-    int totalGrau = 0;
+    long long totalGrau = 0;
 
     // Inicializar valores
     stats->grauMinimo = grafo->numVertices;
@@ -110,7 +141,7 @@ EstatisticasGrafo *calcularEstatisticasGrafo(Grafo *grafo) {
     }
 
     // Calcular grau médio
-    stats->grauMedio = (float)totalGrau / grafo->numVertices;
+    stats->grauMedio = (float)((double)totalGrau / grafo->numVertices);
 
     // Calcular mediana
     qsort(graus, grafo->numVertices, sizeof(int), compararInteiros);
@@ -135,7 +166,9 @@ EstatisticasGrafo *calcularEstatisticasGrafo(Grafo *grafo) {
 
 // Função auxiliar para comparação
 int compararInteiros(const void *a, const void *b) {
-    return (*(int*)a - *(int*)b);
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y); // Evita overflow da subtração
 }
 
 // Cria uma pilha com capacidade específica
@@ -196,12 +229,117 @@ void adicionarArestaGrafo(Grafo *grafo, int u, int v, double capacidade, int dir
         adicionarArestaLista(grafo->grafoLista, u, v, capacidade, direcionado);
     }
     grafo->numArestas++;
+    invalidarCSR(grafo);
+}
+
+// Retorna o ID externo do vértice (índice + 1 quando os IDs são densos)
+long long rotuloVertice(Grafo *grafo, int vertice) {
+    if (grafo->mapaIds != NULL) {
+        return grafo->mapaIds->idsExternos[vertice];
+    }
+    return vertice + 1;
+}
+
+// Retorna o mapeamento reverso de IDs, ou NULL quando os IDs são densos
+const long long *obterIdsExternos(Grafo *grafo) {
+    return grafo->mapaIds != NULL ? grafo->mapaIds->idsExternos : NULL;
+}
+
+// Descarta as representações CSR em cache (chamada sempre que o grafo muda)
+void invalidarCSR(Grafo *grafo) {
+    if (grafo->csrReverso != NULL) {
+        liberarGrafoCSR(grafo->csrReverso);
+    }
+    if (grafo->csr != NULL) {
+        liberarGrafoCSR(grafo->csr);
+    }
+    grafo->csr = NULL;
+    grafo->csrReverso = NULL;
+}
+
+// Retorna a representação CSR do grafo, construindo-a na primeira chamada. A ordem dos
+// vizinhos é a mesma percorrida pelas funções de busca (ordem da lista ou colunas crescentes).
+GrafoCSR *obterCSR(Grafo *grafo) {
+    if (grafo->csr != NULL) {
+        return grafo->csr;
+    }
+
+    int n = grafo->numVertices;
+    long long numArestas = 0;
+    if (grafo->tipo == MATRIZ_ADJACENCIA) {
+        for (int u = 0; u < n; u++) {
+            for (int v = 0; v < n; v++) {
+                if (grafo->grafoMatriz->capacidade[u][v] > 0) {
+                    numArestas++;
+                }
+            }
+        }
+    } else if (grafo->tipo == LISTA_ADJACENCIA) {
+        for (int u = 0; u < n; u++) {
+            for (No *atual = grafo->grafoLista->listaAdj[u]; atual != NULL; atual = atual->prox) {
+                numArestas++;
+            }
+        }
+    }
+
+    GrafoCSR *csr = criarGrafoCSR(n, numArestas);
+    long long e = 0;
+    for (int u = 0; u < n; u++) {
+        csr->inicio[u] = e;
+        if (grafo->tipo == MATRIZ_ADJACENCIA) {
+            for (int v = 0; v < n; v++) {
+                double capacidade = grafo->grafoMatriz->capacidade[u][v];
+                if (capacidade > 0) {
+                    csr->destinos[e] = v;
+                    csr->pesos[e] = capacidade;
+                    e++;
+                }
+            }
+        } else if (grafo->tipo == LISTA_ADJACENCIA) {
+            for (No *atual = grafo->grafoLista->listaAdj[u]; atual != NULL; atual = atual->prox) {
+                csr->destinos[e] = atual->vertice;
+                csr->pesos[e] = atual->capacidade;
+                e++;
+            }
+        }
+    }
+    csr->inicio[n] = e;
+
+    grafo->csr = csr;
+    return csr;
+}
+
+// Retorna a CSR das arestas de entrada. Sempre transpõe, pois grafos marcados como não
+// direcionados também podem receber arcos em um só sentido (ex.: grafo residual).
+GrafoCSR *obterCSRReverso(Grafo *grafo) {
+    if (grafo->csrReverso == NULL) {
+        grafo->csrReverso = transporGrafoCSR(obterCSR(grafo));
+    }
+    return grafo->csrReverso;
+}
+
+// Pais (primeira metade) e níveis (segunda metade) da árvore binária, com -1 para os
+// vértices ainda não visitados nesta chamada. Só os vértices retirados da pilha/fila são
+// registrados, como na saída em texto, para não repetir vértices de buscas anteriores
+// que compartilhem o vetor visitados.
+static int *criarArvoreSaida(int numVertices) {
+    int *arvore = (int *)malloc((size_t)(numVertices > 0 ? 2 * (size_t)numVertices : 1) * sizeof(int));
+    if (!arvore) {
+        fprintf(stderr, "Erro ao alocar memória para a saída da árvore\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < 2 * (size_t)numVertices; i++) {
+        arvore[i] = -1;
+    }
+    return arvore;
 }
 
 // Função principal para DFS com pilha que constrói a árvore DFS
 void dfsComPilhaArvore(Grafo *grafo, int verticeInicial, int *visitados,
-                       Grafo *arvoreDFS, int *pais, int *niveis, FILE *arquivoSaida) {
+                       Grafo *arvoreDFS, int *pais, int *niveis, FILE *arquivoSaida, FormatoSaida formato) {
     Pilha *pilha = criarPilha(grafo->numVertices);
+    BufferSaida *saida = arquivoSaida != NULL ? criarBufferSaida(arquivoSaida, TAMANHO_BUFFER_SAIDA) : NULL;
+    int *arvoreSaida = saida != NULL && formato == SAIDA_BINARIA ? criarArvoreSaida(grafo->numVertices) : NULL;
     push(pilha, verticeInicial);
     visitados[verticeInicial] = 1;  // Marca como visitado no momento em que é empilhado
 
@@ -211,10 +349,13 @@ void dfsComPilhaArvore(Grafo *grafo, int verticeInicial, int *visitados,
     while (!estaVaziaPilha(pilha)) {
         int verticeAtual = pop(pilha);
 
-        // Escreve no arquivo de saída se ele não for NULL
-        if (arquivoSaida != NULL) {
-            fprintf(arquivoSaida, "Vértice: %d, Pai: %d, Nível: %d\n",
-                    verticeAtual + 1, pais[verticeAtual] + 1, niveis[verticeAtual]);
+        // Escreve no buffer de saída se houver arquivo de saída (o binário sai no final)
+        if (arvoreSaida != NULL) {
+            arvoreSaida[verticeAtual] = pais[verticeAtual];
+            arvoreSaida[grafo->numVertices + verticeAtual] = niveis[verticeAtual];
+        } else if (saida != NULL) {
+            escreverLinhaArvore(saida, rotuloVertice(grafo, verticeAtual), rotuloVertice(grafo, pais[verticeAtual]),
+                                niveis[verticeAtual]);
         }
 
         // Adiciona aresta ao grafo árvore, se não for o vértice inicial e arvoreDFS não for NULL
@@ -247,6 +388,14 @@ void dfsComPilhaArvore(Grafo *grafo, int verticeInicial, int *visitados,
         }
     }
 
+    if (saida != NULL) {
+        if (arvoreSaida != NULL) {
+            escreverArvoreBinaria(saida, arvoreSaida, arvoreSaida + grafo->numVertices, grafo->numVertices,
+                                  obterIdsExternos(grafo));
+            free(arvoreSaida);
+        }
+        liberarBufferSaida(saida);
+    }
     liberarPilha(pilha);
 }
 
@@ -309,9 +458,94 @@ void liberarFila(Fila *fila) {
     free(fila);
 }
 
+// Cria um espaço de trabalho para grafos de até numVertices vértices
+EspacoTrabalho *criarEspacoTrabalho(int numVertices) {
+    EspacoTrabalho *espaco = (EspacoTrabalho *)malloc(sizeof(EspacoTrabalho));
+    if (!espaco) {
+        fprintf(stderr, "Erro ao alocar memória para o espaço de trabalho\n");
+        exit(EXIT_FAILURE);
+    }
+    espaco->capacidade = 0;
+    espaco->geracao = 0;
+    espaco->marcas = NULL;
+    espaco->fila = NULL;
+    espaco->distancias = NULL;
+    espaco->sucessores = NULL;
+    espaco->heap = NULL;
+    iniciarBuscaEspaco(espaco, numVertices);
+    return espaco;
+}
+
+// Prepara o espaço para uma nova busca: cresce se o grafo for maior que a capacidade
+// atual e avança a geração, o que desmarca todos os vértices em O(1)
+void iniciarBuscaEspaco(EspacoTrabalho *espaco, int numVertices) {
+    if (numVertices > espaco->capacidade) {
+        int capacidade = numVertices;
+        free(espaco->marcas);
+        free(espaco->fila);
+        free(espaco->distancias);
+        free(espaco->sucessores);
+        if (espaco->heap) {
+            liberarHeapIndexado(espaco->heap);
+        }
+        espaco->marcas = (unsigned int *)calloc((size_t)capacidade, sizeof(unsigned int));
+        espaco->fila = (int *)malloc((size_t)capacidade * sizeof(int));
+        espaco->distancias = (int *)malloc((size_t)capacidade * sizeof(int));
+        espaco->sucessores = NULL;
+        espaco->heap = NULL;
+        if (!espaco->marcas || !espaco->fila || !espaco->distancias) {
+            fprintf(stderr, "Erro ao alocar memória para o espaço de trabalho\n");
+            exit(EXIT_FAILURE);
+        }
+        espaco->capacidade = capacidade;
+        espaco->geracao = 0;
+    }
+
+    // Ao dar a volta no contador, as marcas antigas precisam ser apagadas uma vez
+    espaco->geracao++;
+    if (espaco->geracao == 0) {
+        memset(espaco->marcas, 0, (size_t)espaco->capacidade * sizeof(unsigned int));
+        espaco->geracao = 1;
+    }
+}
+
+// Heap indexado do espaço, criado com a capacidade atual na primeira vez que é pedido
+HeapIndexado *obterHeapEspaco(EspacoTrabalho *espaco) {
+    if (!espaco->heap) {
+        espaco->heap = criarHeapIndexado(espaco->capacidade);
+    }
+    return espaco->heap;
+}
+
+// Vetor de sucessores do espaço, alocado na primeira vez que é pedido
+int *obterSucessoresEspaco(EspacoTrabalho *espaco) {
+    if (!espaco->sucessores) {
+        espaco->sucessores = (int *)malloc((size_t)(espaco->capacidade > 0 ? espaco->capacidade : 1) * sizeof(int));
+        if (!espaco->sucessores) {
+            fprintf(stderr, "Erro ao alocar memória para o espaço de trabalho\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    return espaco->sucessores;
+}
+
+void liberarEspacoTrabalho(EspacoTrabalho *espaco) {
+    free(espaco->marcas);
+    free(espaco->fila);
+    free(espaco->distancias);
+    free(espaco->sucessores);
+    if (espaco->heap) {
+        liberarHeapIndexado(espaco->heap);
+    }
+    free(espaco);
+}
+
 // Função principal para BFS
-void bfsComFilaArvore(Grafo *grafo, int verticeInicial, int *visitados, Grafo *arvoreBFS, int *pais, int *niveis, FILE *arquivoSaida) {
+void bfsComFilaArvore(Grafo *grafo, int verticeInicial, int *visitados, Grafo *arvoreBFS, int *pais, int *niveis,
+                      FILE *arquivoSaida, FormatoSaida formato) {
     Fila *fila = criarFila(grafo->numVertices);
+    BufferSaida *saida = arquivoSaida != NULL ? criarBufferSaida(arquivoSaida, TAMANHO_BUFFER_SAIDA) : NULL;
+    int *arvoreSaida = saida != NULL && formato == SAIDA_BINARIA ? criarArvoreSaida(grafo->numVertices) : NULL;
     enqueue(fila, verticeInicial);
     visitados[verticeInicial] = 1;
     pais[verticeInicial] = verticeInicial; // O pai do vértice inicial é ele mesmo
@@ -320,9 +554,13 @@ void bfsComFilaArvore(Grafo *grafo, int verticeInicial, int *visitados, Grafo *a
     while (!estaVaziaFila(fila)) {
         int verticeAtual = dequeue(fila);
 
-        // Escreve no arquivo de saída se ele não for NULL
-        if (arquivoSaida != NULL) {
-            fprintf(arquivoSaida, "Vértice: %d, Pai: %d, Nível: %d\n", verticeAtual + 1, pais[verticeAtual] + 1, niveis[verticeAtual]);
+        // Escreve no buffer de saída se houver arquivo de saída (o binário sai no final)
+        if (arvoreSaida != NULL) {
+            arvoreSaida[verticeAtual] = pais[verticeAtual];
+            arvoreSaida[grafo->numVertices + verticeAtual] = niveis[verticeAtual];
+        } else if (saida != NULL) {
+            escreverLinhaArvore(saida, rotuloVertice(grafo, verticeAtual), rotuloVertice(grafo, pais[verticeAtual]),
+                                niveis[verticeAtual]);
         }
 
         // Adiciona aresta à árvore BFS se não for o vértice inicial e se arvoreBFS não for NULL
@@ -355,88 +593,114 @@ void bfsComFilaArvore(Grafo *grafo, int verticeInicial, int *visitados, Grafo *a
         }
     }
 
+    if (saida != NULL) {
+        if (arvoreSaida != NULL) {
+            escreverArvoreBinaria(saida, arvoreSaida, arvoreSaida + grafo->numVertices, grafo->numVertices,
+                                  obterIdsExternos(grafo));
+            free(arvoreSaida);
+        }
+        liberarBufferSaida(saida);
+    }
     liberarFila(fila);
 }
 
+// Função para descobrir as componentes do grafo. Em grafos não direcionados usa union-find
+// (tempo quase linear); em grafos direcionados mantém a semântica anterior (cada vértice
+// recebe o rótulo da primeira raiz, em ordem crescente, cuja BFS o alcança), com uma
+// única fila reaproveitada e sem reinicializar vetores a cada componente: O(V + E).
 void descobrirComponentes(Grafo *grafo, int *componentes, int *numComponentes) {
+    if (!grafo->direcionado) {
+        descobrirComponentesUnionFind(grafo, componentes, numComponentes);
+        return;
+    }
+
+    GrafoCSR *csr = obterCSR(grafo);
     int *visitados = (int *)calloc(grafo->numVertices, sizeof(int));
-    int *pais = (int *)malloc(grafo->numVertices * sizeof(int));
-    int *niveis = (int *)malloc(grafo->numVertices * sizeof(int));
+    Fila *fila = criarFila(grafo->numVertices);
     *numComponentes = 0;
 
     for (int v = 0; v < grafo->numVertices; v++) {
-        if (!visitados[v]) {
-            (*numComponentes)++;
-            // Inicializa os arrays 'pais' e 'niveis' para esta BFS
-            for (int i = 0; i < grafo->numVertices; i++) {
-                pais[i] = -1;
-                niveis[i] = -1;
-            }
-
-            // Chama a BFS a partir do vértice 'v' sem gerar saída e sem construir a árvore BFS
-            bfsComFilaArvore(grafo, v, visitados, NULL, pais, niveis, NULL);
-
-            // Após a BFS, todos os vértices visitados pertencem à mesma componente
-            for (int u = 0; u < grafo->numVertices; u++) {
-                if (visitados[u] && componentes[u] == 0 && (pais[u] != -1 || u == v)) {
-                    componentes[u] = *numComponentes;
+        if (visitados[v]) {
+            continue;
+        }
+        (*numComponentes)++;
+        visitados[v] = 1;
+        if (componentes[v] == 0) {
+            componentes[v] = *numComponentes;
+        }
+        enqueue(fila, v);
+
+        // Todos os vértices alcançados por esta BFS pertencem à mesma componente
+        while (!estaVaziaFila(fila)) {
+            int u = dequeue(fila);
+            for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+                int w = csr->destinos[e];
+                if (!visitados[w]) {
+                    visitados[w] = 1;
+                    if (componentes[w] == 0) {
+                        componentes[w] = *numComponentes;
+                    }
+                    enqueue(fila, w);
                 }
             }
         }
     }
 
+    liberarFila(fila);
     free(visitados);
-    free(pais);
-    free(niveis);
 }
 
 // Função para calcular a distância mínima entre dois vértices usando BFS
 int calcularDistancia(Grafo *grafo, int origem, int destino) {
+    EspacoTrabalho *espaco = criarEspacoTrabalho(grafo->numVertices);
+    int distancia = calcularDistanciaComEspaco(grafo, origem, destino, espaco);
+    liberarEspacoTrabalho(espaco);
+    return distancia;
+}
+
+// BFS com o espaço de trabalho: só os vértices alcançados são tocados
+int calcularDistanciaComEspaco(Grafo *grafo, int origem, int destino, EspacoTrabalho *espaco) {
     if (origem < 0 || origem >= grafo->numVertices || destino < 0 || destino >= grafo->numVertices) {
         printf("Vértices inválidos.\n");
         return -1;
     }
 
-    int *visitados = (int *)calloc(grafo->numVertices, sizeof(int));
-    int *distancias = (int *)malloc(grafo->numVertices * sizeof(int));
-    for (int i = 0; i < grafo->numVertices; i++) {
-        distancias[i] = -1; // Inicializa todas as distâncias como -1 (não alcançado)
-    }
+    iniciarBuscaEspaco(espaco, grafo->numVertices);
+    unsigned int geracao = espaco->geracao;
+    unsigned int *marcas = espaco->marcas;
+    int *distancias = espaco->distancias;
+    int *fila = espaco->fila;
+    int frente = 0, tras = 0;
 
-    Fila *fila = criarFila(grafo->numVertices);
-    enqueue(fila, origem);
-    visitados[origem] = 1;
+    fila[tras++] = origem;
+    marcas[origem] = geracao;
     distancias[origem] = 0;
 
-    while (!estaVaziaFila(fila)) {
-        int verticeAtual = dequeue(fila);
+    while (frente < tras) {
+        int verticeAtual = fila[frente++];
 
         // Se encontramos o destino, podemos retornar a distância
         if (verticeAtual == destino) {
-            int distancia = distancias[destino];
-            liberarFila(fila);
-            free(visitados);
-            free(distancias);
-            return distancia;
+            return distancias[destino];
         }
 
         // Explora os vértices adjacentes
         if (grafo->tipo == MATRIZ_ADJACENCIA) {
             for (int j = 0; j < grafo->numVertices; j++) {
-                if (grafo->grafoMatriz->capacidade[verticeAtual][j] > 0 && !visitados[j]) {
-                    visitados[j] = 1;
+                if (grafo->grafoMatriz->capacidade[verticeAtual][j] > 0 && marcas[j] != geracao) {
+                    marcas[j] = geracao;
                     distancias[j] = distancias[verticeAtual] + 1;
-                    enqueue(fila, j);
+                    fila[tras++] = j;
                 }
             }
         } else if (grafo->tipo == LISTA_ADJACENCIA) {
             No *atual = grafo->grafoLista->listaAdj[verticeAtual];
             while (atual != NULL) {
                 int v = atual->vertice;
-                if (!visitados[v]) {
-                    visitados[v] = 1;
+                if (marcas[v] != geracao) {
+                    marcas[v] = geracao;
                     distancias[v] = distancias[verticeAtual] + 1;
-                    enqueue(fila, v);
+                    fila[tras++] = v;
                 }
                 atual = atual->prox;
             }
@@ -444,22 +708,35 @@ int calcularDistancia(Grafo *grafo, int origem, int destino) {
     }
 
     // Se o destino não foi alcançado, os vértices não estão conectados
-    liberarFila(fila);
-    free(visitados);
-    free(distancias);
-    return -1; // Indica que não há caminho entre origem e destino
+    return -1;
+}
+
+// Função para verificar se alguma aresta tem peso negativo. Na matriz de adjacência só
+// capacidades positivas contam como arestas, então o resultado é sempre 0 nela.
+int possuiPesosNegativos(Grafo *grafo) {
+    return obterPesosNegativos(obterCSR(grafo));
 }
 
 // Função de Dijkstra utilizando vetor
 void dijkstraVetor(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais) {
+    EspacoTrabalho *espaco = criarEspacoTrabalho(grafo->numVertices);
+    dijkstraVetorComEspaco(grafo, origem, imprimir, distancia, pais, espaco);
+    liberarEspacoTrabalho(espaco);
+}
+
+// Dijkstra com vetor usando as marcas do espaço de trabalho como conjunto de visitados
+void dijkstraVetorComEspaco(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais, EspacoTrabalho *espaco) {
     int numVertices = grafo->numVertices;
-    int *visitados = (int *)calloc(numVertices, sizeof(int));
 
-    if (!distancia || !visitados || !pais) {
+    if (!distancia || !pais) {
         printf("Erro ao alocar memória para arrays de Dijkstra.\n");
         return;
     }
 
+    iniciarBuscaEspaco(espaco, numVertices);
+    unsigned int geracao = espaco->geracao;
+    unsigned int *visitados = espaco->marcas;
+
     // Inicializa o array de distâncias com infinito e os pais com -1
     for (int i = 0; i < numVertices; i++) {
         distancia[i] = DBL_MAX;
@@ -468,78 +745,43 @@ void dijkstraVetor(Grafo *grafo, int origem, int imprimir, double *distancia, in
 
     distancia[origem] = 0.0;
 
+    // Kernels AVX2/AVX-512 para a busca do mínimo e a relaxação das linhas da matriz,
+    // com o mesmo resultado da versão escalar
+    NivelKernelVetor nivel = detectarKernelVetor();
+
     // Algoritmo de Dijkstra
     for (int i = 0; i < numVertices - 1; i++) {
         // Encontrar o vértice com a menor distância que ainda não foi visitado
-        double minDistancia = DBL_MAX;
-        int u = -1;
+        int u = encontrarMinimoNaoVisitado(nivel, distancia, visitados, geracao, numVertices);
 
-        for (int v = 0; v < numVertices; v++) {
-            if (!visitados[v] && distancia[v] < minDistancia) {
-                minDistancia = distancia[v];
-                u = v;
-            }
+        // Nenhum vértice alcançável restante
+        if (u == -1) {
+            break;
         }
 
         // Marca o vértice como visitado
-        if (u != -1) {
-            visitados[u] = 1;
-
-            // Atualizar as distâncias dos vértices adjacentes
-            if (grafo->tipo == MATRIZ_ADJACENCIA) {
-                for (int v = 0; v < numVertices; v++) {
-                    if (grafo->grafoMatriz->capacidade[u][v] > 0 && !visitados[v]) {
-                        double peso = grafo->grafoMatriz->capacidade[u][v];
-                        if (distancia[u] + peso < distancia[v]) {
-                            distancia[v] = distancia[u] + peso;
-                            pais[v] = u;
-                        }
-                    }
-                }
-            } else if (grafo->tipo == LISTA_ADJACENCIA) {
-                No *adjacente = grafo->grafoLista->listaAdj[u];
-                while (adjacente != NULL) {
-                    int v = adjacente->vertice;
-                    double peso = adjacente->capacidade;
-                    if (!visitados[v] && distancia[u] + peso < distancia[v]) {
-                        distancia[v] = distancia[u] + peso;
-                        pais[v] = u;
-                    }
-                    adjacente = adjacente->prox;
-                }
-            }
-        }
-    }
+        visitados[u] = geracao;
 
-    // Exibir as distâncias mínimas e os caminhos se 'imprimir' for verdadeiro
-    if (imprimir) {
-        printf("Distâncias mínimas a partir do vértice %d:\n", origem + 1);
-        for (int i = 0; i < numVertices; i++) {
-            if (distancia[i] == DBL_MAX) {
-                printf("Vértice %d: Inacessível\n", i + 1);
-            } else {
-                printf("Vértice %d: %.2f (Caminho: ", i + 1, distancia[i]);
-                // Reconstruir o caminho
-                int v = i;
-                int caminho[numVertices];
-                int tamanhoCaminho = 0;
-                while (v != -1) {
-                    caminho[tamanhoCaminho++] = v;
-                    v = pais[v];
-                }
-                // Imprimir o caminho na ordem correta
-                for (int j = tamanhoCaminho - 1; j >= 0; j--) {
-                    printf("%d", caminho[j] + 1);
-                    if (j > 0) {
-                        printf(" -> ");
-                    }
+        // Atualizar as distâncias dos vértices adjacentes
+        if (grafo->tipo == MATRIZ_ADJACENCIA) {
+            relaxarLinhaMatriz(nivel, grafo->grafoMatriz->capacidade[u], u, distancia, pais, visitados, geracao,
+                               numVertices);
+        } else if (grafo->tipo == LISTA_ADJACENCIA) {
+            No *adjacente = grafo->grafoLista->listaAdj[u];
+            while (adjacente != NULL) {
+                int v = adjacente->vertice;
+                double peso = adjacente->capacidade;
+                if (visitados[v] != geracao && distancia[u] + peso < distancia[v]) {
+                    distancia[v] = distancia[u] + peso;
+                    pais[v] = u;
                 }
-                printf(")\n");
+                adjacente = adjacente->prox;
             }
         }
     }
 
-    free(visitados);
+    // Exibir as distâncias mínimas e os caminhos (em texto ou binário) conforme 'imprimir'
+    imprimirCaminhosMinimos(imprimir, origem, distancia, pais, numVertices, obterIdsExternos(grafo));
 }
 
 // Funções do MinHeap (usado no Dijkstra com heap)
@@ -648,91 +890,181 @@ void liberarMinHeap(MinHeap *minHeap) {
 
 // Função de Dijkstra utilizando heap
 void dijkstraHeap(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais) {
-    int numVertices = grafo->numVertices;
+    EspacoTrabalho *espaco = criarEspacoTrabalho(grafo->numVertices);
+    dijkstraHeapComEspaco(grafo, origem, imprimir, distancia, pais, espaco);
+    liberarEspacoTrabalho(espaco);
+}
 
-    // Cria o Min Heap e inicializa
-    MinHeap* minHeap = criarMinHeap(numVertices);
+// Dijkstra com o heap 4-ário indexado do espaço de trabalho. A inserção é preguiçosa:
+// só os vértices alcançados entram no heap (marcados na geração atual), e um vértice
+// marcado com posição -1 já foi finalizado.
+static void executarDijkstraHeap(GrafoCSR *csr, int origem, double *distancia, int *pais, EspacoTrabalho *espaco) {
+    unsigned int geracao = espaco->geracao;
+    unsigned int *alcancados = espaco->marcas;
+    HeapIndexado *heap = obterHeapEspaco(espaco);
+    heap->tamanho = 0;
 
-    for (int v = 0; v < numVertices; v++) {
-        distancia[v] = DBL_MAX;
-        pais[v] = -1;
-        minHeap->array[v] = (HeapNode*) malloc(sizeof(HeapNode));
-        minHeap->array[v]->vertice = v;
-        minHeap->array[v]->distancia = distancia[v];
-        minHeap->posicoes[v] = v;
+    distancia[origem] = 0.0;
+    alcancados[origem] = geracao;
+    inserirHeapIndexado(heap, origem, 0.0);
+
+    while (heap->tamanho > 0) {
+        int u = extrairMinimoHeapIndexado(heap).vertice;
+
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int v = csr->destinos[e];
+            double novaDistancia = distancia[u] + csr->pesos[e];
+            if (alcancados[v] != geracao) {
+                alcancados[v] = geracao;
+                distancia[v] = novaDistancia;
+                pais[v] = u;
+                inserirHeapIndexado(heap, v, novaDistancia);
+            } else if (heap->posicoes[v] >= 0 && novaDistancia < distancia[v]) {
+                distancia[v] = novaDistancia;
+                pais[v] = u;
+                diminuirChaveHeapIndexado(heap, v, novaDistancia);
+            }
+        }
     }
+}
 
-    // Define a distância do vértice de origem como zero e atualiza no heap
-    distancia[origem] = 0.0;
-    diminuirChave(minHeap, origem, distancia[origem]);
+// Insere v no início do balde (lista duplamente encadeada)
+static void inserirBalde(int *cabecas, int *proximo, int *anterior, int balde, int v) {
+    proximo[v] = cabecas[balde];
+    anterior[v] = -1;
+    if (cabecas[balde] != -1) {
+        anterior[cabecas[balde]] = v;
+    }
+    cabecas[balde] = v;
+}
 
-    minHeap->tamanho = numVertices;
+static void removerBalde(int *cabecas, int *proximo, int *anterior, int balde, int v) {
+    if (anterior[v] != -1) {
+        proximo[anterior[v]] = proximo[v];
+    } else {
+        cabecas[balde] = proximo[v];
+    }
+    if (proximo[v] != -1) {
+        anterior[proximo[v]] = anterior[v];
+    }
+}
 
-    // Enquanto o heap não estiver vazio
-    while (!estaVazioHeap(minHeap)) {
-        // Extrai o vértice com a menor distância
-        HeapNode* minNode = extrairMinimo(minHeap);
-        int u = minNode->vertice;
-        free(minNode); // Libera o nó extraído
+// Algoritmo de Dial: pesos inteiros em [1, pesoMaximo] permitem pesoMaximo + 1 baldes
+// circulares, indexados pela distância módulo o número de baldes. Os baldes são listas
+// duplamente encadeadas sobre os vetores fila/sucessores do espaço de trabalho, e
+// anterior = -2 indica vértice finalizado. Entre predecessores de mesma distância o pai
+// é o de menor índice, reproduzindo a ordem de extração do heap.
+static void executarDijkstraDial(GrafoCSR *csr, int origem, long long pesoMaximo, double *distancia, int *pais,
+                                 EspacoTrabalho *espaco) {
+    long long numBaldes = pesoMaximo + 1;
+    int *cabecas = (int *)malloc((size_t)numBaldes * sizeof(int));
+    if (!cabecas) {
+        fprintf(stderr, "Erro ao alocar memória para os baldes\n");
+        exit(EXIT_FAILURE);
+    }
+    for (long long b = 0; b < numBaldes; b++) {
+        cabecas[b] = -1;
+    }
+    unsigned int geracao = espaco->geracao;
+    unsigned int *alcancados = espaco->marcas;
+    int *proximo = espaco->fila;
+    int *anterior = obterSucessoresEspaco(espaco);
 
-        // Para cada vizinho de u
-        if (grafo->tipo == MATRIZ_ADJACENCIA) {
-            for (int v = 0; v < numVertices; v++) {
-                double peso = grafo->grafoMatriz->capacidade[u][v];
-                if (peso > 0 && estaNoHeap(minHeap, v)) {
-                    if (distancia[u] + peso < distancia[v]) {
-                        distancia[v] = distancia[u] + peso;
-                        pais[v] = u;
-                        diminuirChave(minHeap, v, distancia[v]);
-                    }
-                }
-            }
-        } else if (grafo->tipo == LISTA_ADJACENCIA) {
-            No *adjacente = grafo->grafoLista->listaAdj[u];
-            while (adjacente != NULL) {
-                int v = adjacente->vertice;
-                double peso = adjacente->capacidade;
-                if (estaNoHeap(minHeap, v)) {
-                    if (distancia[u] + peso < distancia[v]) {
-                        distancia[v] = distancia[u] + peso;
-                        pais[v] = u;
-                        diminuirChave(minHeap, v, distancia[v]);
-                    }
+    distancia[origem] = 0.0;
+    alcancados[origem] = geracao;
+    inserirBalde(cabecas, proximo, anterior, 0, origem);
+    long long pendentes = 1;
+    long long atual = 0;
+
+    while (pendentes > 0) {
+        int balde = (int)(atual % numBaldes);
+        int u = cabecas[balde];
+        if (u == -1) {
+            atual++;
+            continue;
+        }
+        removerBalde(cabecas, proximo, anterior, balde, u);
+        anterior[u] = -2;
+        pendentes--;
+
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int v = csr->destinos[e];
+            long long novaDistancia = atual + (long long)csr->pesos[e];
+            if (alcancados[v] != geracao) {
+                alcancados[v] = geracao;
+                distancia[v] = (double)novaDistancia;
+                pais[v] = u;
+                inserirBalde(cabecas, proximo, anterior, (int)(novaDistancia % numBaldes), v);
+                pendentes++;
+            } else if (anterior[v] != -2) {
+                if ((double)novaDistancia < distancia[v]) {
+                    removerBalde(cabecas, proximo, anterior, (int)((long long)distancia[v] % numBaldes), v);
+                    distancia[v] = (double)novaDistancia;
+                    pais[v] = u;
+                    inserirBalde(cabecas, proximo, anterior, (int)(novaDistancia % numBaldes), v);
+                } else if ((double)novaDistancia == distancia[v] && distancia[pais[v]] == (double)atual && u < pais[v]) {
+                    pais[v] = u;
                 }
-                adjacente = adjacente->prox;
             }
         }
     }
 
-    // Exibir as distâncias mínimas e os caminhos se 'imprimir' for verdadeiro
-    if (imprimir) {
-        printf("Distâncias mínimas a partir do vértice %d:\n", origem + 1);
-        for (int i = 0; i < numVertices; i++) {
-            if (distancia[i] == DBL_MAX) {
-                printf("Vértice %d: Inacessível\n", i + 1);
-            } else {
-                printf("Vértice %d: %.2f (Caminho: ", i + 1, distancia[i]);
-                // Reconstruir o caminho
-                int v = i;
-                int caminho[numVertices];
-                int tamanhoCaminho = 0;
-                while (v != -1) {
-                    caminho[tamanhoCaminho++] = v;
-                    v = pais[v];
-                }
-                // Imprimir o caminho na ordem correta
-                for (int j = tamanhoCaminho - 1; j >= 0; j--) {
-                    printf("%d", caminho[j] + 1);
-                    if (j > 0) {
-                        printf(" -> ");
-                    }
-                }
-                printf(")\n");
-            }
-        }
+    free(cabecas);
+}
+
+// Inicializa as saídas e escolhe a fila de prioridade: baldes de Dial quando todos os
+// pesos são inteiros positivos até LIMITE_PESO_DIAL (se permitido), heap caso contrário
+static void executarDijkstraCSR(GrafoCSR *csr, int origem, double *distancia, int *pais, EspacoTrabalho *espaco,
+                                int permitirDial) {
+    int numVertices = csr->numVertices;
+
+    iniciarBuscaEspaco(espaco, numVertices);
+    for (int v = 0; v < numVertices; v++) {
+        distancia[v] = DBL_MAX;
+        pais[v] = -1;
     }
 
-    liberarMinHeap(minHeap);
+    long long pesoMaximo = permitirDial ? obterPesoInteiroMaximo(csr) : -1;
+    if (pesoMaximo > 0 && pesoMaximo <= LIMITE_PESO_DIAL) {
+        executarDijkstraDial(csr, origem, pesoMaximo, distancia, pais, espaco);
+    } else {
+        executarDijkstraHeap(csr, origem, distancia, pais, espaco);
+    }
+}
+
+// Dijkstra direto sobre uma representação CSR (por exemplo a reversa, para distâncias
+// até a origem), com a mesma seleção automática de fila de prioridade
+void dijkstraCSRComEspaco(GrafoCSR *csr, int origem, double *distancia, int *pais, EspacoTrabalho *espaco) {
+    executarDijkstraCSR(csr, origem, distancia, pais, espaco, 1);
+}
+
+static void executarDijkstra(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais,
+                             EspacoTrabalho *espaco, int permitirDial) {
+    int numVertices = grafo->numVertices;
+    GrafoCSR *csr = obterCSR(grafo);
+
+    // Dijkstra não é correto com pesos negativos: usa o Bellman-Ford com fila, que também
+    // informa um ciclo negativo alcançável (nesse caso as distâncias não são válidas)
+    if (obterPesosNegativos(csr)) {
+        bellmanFordFila(grafo, origem, imprimir, distancia, pais, NULL, NULL);
+        return;
+    }
+    executarDijkstraCSR(csr, origem, distancia, pais, espaco, permitirDial);
+
+    // Exibir as distâncias mínimas e os caminhos (em texto ou binário) conforme 'imprimir'
+    imprimirCaminhosMinimos(imprimir, origem, distancia, pais, numVertices, obterIdsExternos(grafo));
+}
+
+// Dijkstra com fila de prioridade; usa os baldes de Dial automaticamente quando os pesos
+// são inteiros pequenos (mesmos resultados, inclusive os pais)
+void dijkstraHeapComEspaco(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais, EspacoTrabalho *espaco) {
+    executarDijkstra(grafo, origem, imprimir, distancia, pais, espaco, 1);
+}
+
+// Dijkstra sempre com o heap indexado, sem a seleção automática
+void dijkstraHeapIndexadoComEspaco(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais,
+                                   EspacoTrabalho *espaco) {
+    executarDijkstra(grafo, origem, imprimir, distancia, pais, espaco, 0);
 }
 
 // Funções para o algoritmo de Ford-Fulkerson
@@ -745,6 +1077,7 @@ void adicionarArestaResidual(Grafo *grafo, int u, int v, double capacidade, int
         adicionarArestaListaResidual(grafo->grafoLista, u, v, capacidade, original);
     }
     grafo->numArestas++;
+    invalidarCSR(grafo);
 }
 
 // Função para criar o grafo residual a partir do grafo original
@@ -799,33 +1132,40 @@ Grafo *criarGrafoResidual(Grafo *grafoOriginal) {
 
 // Função para encontrar um caminho aumentante usando BFS
 int encontrarCaminhoAumentante(Grafo *grafoResidual, int origem, int destino, int *pais) {
-    int numVertices = grafoResidual->numVertices;
-    int *visitados = (int *)calloc(numVertices, sizeof(int));
-    Fila *fila = criarFila(numVertices);
-
-    for (int i = 0; i < numVertices; i++) {
-        visitados[i] = 0;
+    for (int i = 0; i < grafoResidual->numVertices; i++) {
         pais[i] = -1;
     }
+    EspacoTrabalho *espaco = criarEspacoTrabalho(grafoResidual->numVertices);
+    int encontrado = encontrarCaminhoAumentanteComEspaco(grafoResidual, origem, destino, pais, espaco);
+    liberarEspacoTrabalho(espaco);
+    return encontrado;
+}
 
-    enqueue(fila, origem);
-    visitados[origem] = 1;
+// BFS do caminho aumentante sem limpar pais: apenas os vértices marcados são escritos
+int encontrarCaminhoAumentanteComEspaco(Grafo *grafoResidual, int origem, int destino, int *pais, EspacoTrabalho *espaco) {
+    iniciarBuscaEspaco(espaco, grafoResidual->numVertices);
+    unsigned int geracao = espaco->geracao;
+    unsigned int *visitados = espaco->marcas;
+    int *fila = espaco->fila;
+    int frente = 0, tras = 0;
 
-    while (!estaVaziaFila(fila)) {
-        int u = dequeue(fila);
+    fila[tras++] = origem;
+    visitados[origem] = geracao;
+    pais[origem] = -1;
+
+    while (frente < tras) {
+        int u = fila[frente++];
 
         if (grafoResidual->tipo == LISTA_ADJACENCIA) {
             No *atual = grafoResidual->grafoLista->listaAdj[u];
             while (atual != NULL) {
                 int v = atual->vertice;
-                if (!visitados[v]) {
-                    visitados[v] = 1;
+                if (visitados[v] != geracao) {
+                    visitados[v] = geracao;
                     pais[v] = u;
-                    enqueue(fila, v);
+                    fila[tras++] = v;
 
                     if (v == destino) {
-                        liberarFila(fila);
-                        free(visitados);
                         return 1; // Caminho encontrado
                     }
                 }
@@ -833,14 +1173,12 @@ int encontrarCaminhoAumentante(Grafo *grafoResidual, int origem, int destino, in
             }
         } else if (grafoResidual->tipo == MATRIZ_ADJACENCIA) {
             for (int v = 0; v < grafoResidual->numVertices; v++) {
-                if (grafoResidual->grafoMatriz->capacidade[u][v] > 0 && !visitados[v]) {
-                    visitados[v] = 1;
+                if (grafoResidual->grafoMatriz->capacidade[u][v] > 0 && visitados[v] != geracao) {
+                    visitados[v] = geracao;
                     pais[v] = u;
-                    enqueue(fila, v);
+                    fila[tras++] = v;
 
                     if (v == destino) {
-                        liberarFila(fila);
-                        free(visitados);
                         return 1; // Caminho encontrado
                     }
                 }
@@ -848,8 +1186,6 @@ int encontrarCaminhoAumentante(Grafo *grafoResidual, int origem, int destino, in
         }
     }
 
-    liberarFila(fila);
-    free(visitados);
     return 0; // Nenhum caminho encontrado
 }
 
@@ -945,6 +1281,7 @@ double fordFulkerson(Grafo *grafoOriginal, int origem, int destino) {
     double fluxoMaximo = 0.0;
     int numVertices = grafoOriginal->numVertices;
     int *pais = (int *)malloc(numVertices * sizeof(int));
+    EspacoTrabalho *espaco = criarEspacoTrabalho(numVertices);
 
     // Inicializa o fluxo no grafo original
     if (grafoOriginal->tipo == LISTA_ADJACENCIA) {
@@ -966,7 +1303,7 @@ double fordFulkerson(Grafo *grafoOriginal, int origem, int destino) {
     while (1) {
         Grafo *grafoResidual = criarGrafoResidual(grafoOriginal);
 
-        int caminhoEncontrado = encontrarCaminhoAumentante(grafoResidual, origem, destino, pais);
+        int caminhoEncontrado = encontrarCaminhoAumentanteComEspaco(grafoResidual, origem, destino, pais, espaco);
 
         if (!caminhoEncontrado) {
             liberarGrafo(grafoResidual);
@@ -983,6 +1320,7 @@ double fordFulkerson(Grafo *grafoOriginal, int origem, int destino) {
     }
 
     free(pais);
+    liberarEspacoTrabalho(espaco);
 
     return fluxoMaximo;
 }
@@ -0,0 +1,96 @@
+#include "../include/grafo_csr.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+GrafoCSR *criarGrafoCSR(int numVertices, long long numArestas) {
+    GrafoCSR *csr = (GrafoCSR *)malloc(sizeof(GrafoCSR));
+    if (!csr) {
+        fprintf(stderr, "Erro ao alocar memória para o grafo CSR\n");
+        exit(EXIT_FAILURE);
+    }
+    csr->numVertices = numVertices;
+    csr->numArestas = numArestas;
+    csr->pesoInteiroMaximo = PESO_NAO_CALCULADO;
+    csr->pesosNegativos = PESO_NAO_CALCULADO;
+    csr->inicio = (long long *)calloc((size_t)numVertices + 1, sizeof(long long));
+    csr->destinos = (int *)malloc((size_t)(numArestas > 0 ? numArestas : 1) * sizeof(int));
+    csr->pesos = (double *)malloc((size_t)(numArestas > 0 ? numArestas : 1) * sizeof(double));
+    if (!csr->inicio || !csr->destinos || !csr->pesos) {
+        fprintf(stderr, "Erro ao alocar memória para o grafo CSR\n");
+        exit(EXIT_FAILURE);
+    }
+    return csr;
+}
+
+void liberarGrafoCSR(GrafoCSR *csr) {
+    free(csr->inicio);
+    free(csr->destinos);
+    free(csr->pesos);
+    free(csr);
+}
+
+// Cria o grafo transposto (arestas invertidas), mantendo a ordem das origens
+GrafoCSR *transporGrafoCSR(const GrafoCSR *csr) {
+    int n = csr->numVertices;
+    GrafoCSR *transposto = criarGrafoCSR(n, csr->numArestas);
+
+    for (long long e = 0; e < csr->numArestas; e++) {
+        transposto->inicio[csr->destinos[e] + 1]++;
+    }
+    for (int v = 0; v < n; v++) {
+        transposto->inicio[v + 1] += transposto->inicio[v];
+    }
+
+    long long *posicao = (long long *)malloc((size_t)n * sizeof(long long));
+    if (!posicao) {
+        fprintf(stderr, "Erro ao alocar memória para o grafo CSR\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        posicao[v] = transposto->inicio[v];
+    }
+    for (int u = 0; u < n; u++) {
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            long long p = posicao[csr->destinos[e]]++;
+            transposto->destinos[p] = u;
+            transposto->pesos[p] = csr->pesos[e];
+        }
+    }
+    free(posicao);
+    return transposto;
+}
+
+// Examina os pesos uma única vez; o CSR é descartado quando o grafo muda
+long long obterPesoInteiroMaximo(GrafoCSR *csr) {
+    if (csr->pesoInteiroMaximo != PESO_NAO_CALCULADO) {
+        return csr->pesoInteiroMaximo;
+    }
+    long long maximo = 0;
+    for (long long e = 0; e < csr->numArestas; e++) {
+        double peso = csr->pesos[e];
+        if (!(peso >= 1.0 && peso <= 9007199254740992.0) || peso != (double)(long long)peso) {
+            maximo = -1;
+            break;
+        }
+        if ((long long)peso > maximo) {
+            maximo = (long long)peso;
+        }
+    }
+    csr->pesoInteiroMaximo = maximo;
+    return maximo;
+}
+
+int obterPesosNegativos(GrafoCSR *csr) {
+    if (csr->pesosNegativos != PESO_NAO_CALCULADO) {
+        return csr->pesosNegativos;
+    }
+    int negativos = 0;
+    for (long long e = 0; e < csr->numArestas; e++) {
+        if (csr->pesos[e] < 0) {
+            negativos = 1;
+            break;
+        }
+    }
+    csr->pesosNegativos = negativos;
+    return negativos;
+}
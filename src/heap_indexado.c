@@ -0,0 +1,30 @@
+#include "../include/heap_indexado.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+// Cria um heap indexado para vértices 0 .. capacidade - 1
+HeapIndexado *criarHeapIndexado(int capacidade) {
+    HeapIndexado *heap = (HeapIndexado *)malloc(sizeof(HeapIndexado));
+    if (!heap) {
+        fprintf(stderr, "Erro ao alocar memória para o heap\n");
+        exit(EXIT_FAILURE);
+    }
+    if (capacidade < 1) {
+        capacidade = 1;
+    }
+    heap->tamanho = 0;
+    heap->capacidade = capacidade;
+    heap->itens = (ItemHeap *)malloc((size_t)capacidade * sizeof(ItemHeap));
+    heap->posicoes = (int *)malloc((size_t)capacidade * sizeof(int));
+    if (!heap->itens || !heap->posicoes) {
+        fprintf(stderr, "Erro ao alocar memória para o heap\n");
+        exit(EXIT_FAILURE);
+    }
+    return heap;
+}
+
+void liberarHeapIndexado(HeapIndexado *heap) {
+    free(heap->itens);
+    free(heap->posicoes);
+    free(heap);
+}
@@ -0,0 +1,753 @@
+#include "../include/hierarquia_contracao.h"
+#include "../include/heap_indexado.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <float.h>
+
+#define MAGICO_HIERARQUIA "GRFH"
+#define MAGICO_IDS "GRFI"
+
+// Arco do grafo durante a contração (lista de saída ou de entrada de um vértice)
+typedef struct {
+    int vizinho;
+    int meio;
+    double peso;
+} ArcoContracao;
+
+typedef struct {
+    ArcoContracao *arcos;
+    int tamanho;
+    int capacidade;
+} ListaArcos;
+
+// Arcos definitivos da hierarquia, gravados quando a origem é contraída
+typedef struct {
+    int *origens;
+    int *destinos;
+    double *pesos;
+    int *meios;
+    long long numArcos;
+    long long capacidade;
+} BufferArcosHierarquia;
+
+typedef struct {
+    int numVertices;
+    ListaArcos *saidas;
+    ListaArcos *entradas;
+    int *vizinhosContraidos;
+    EspacoTrabalho *espaco;     // Busca de testemunhas
+    double *distancias;
+    unsigned int *marcasAlvo;   // Destinos dos possíveis atalhos da busca atual
+    unsigned int rodadaAlvo;
+} EstadoContracao;
+
+// Insere o arco para vizinho ou reduz o peso do existente (mantém só o menor)
+static void inserirOuReduzirArco(ListaArcos *lista, int vizinho, double peso, int meio) {
+    for (int i = 0; i < lista->tamanho; i++) {
+        if (lista->arcos[i].vizinho == vizinho) {
+            if (peso < lista->arcos[i].peso) {
+                lista->arcos[i].peso = peso;
+                lista->arcos[i].meio = meio;
+            }
+            return;
+        }
+    }
+    if (lista->tamanho == lista->capacidade) {
+        lista->capacidade = lista->capacidade > 0 ? lista->capacidade * 2 : 4;
+        lista->arcos = (ArcoContracao *)realloc(lista->arcos, (size_t)lista->capacidade * sizeof(ArcoContracao));
+        if (!lista->arcos) {
+            fprintf(stderr, "Erro ao alocar memória para os arcos da contração\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    lista->arcos[lista->tamanho].vizinho = vizinho;
+    lista->arcos[lista->tamanho].meio = meio;
+    lista->arcos[lista->tamanho].peso = peso;
+    lista->tamanho++;
+}
+
+static void removerArco(ListaArcos *lista, int vizinho) {
+    for (int i = 0; i < lista->tamanho; i++) {
+        if (lista->arcos[i].vizinho == vizinho) {
+            lista->arcos[i] = lista->arcos[--lista->tamanho];
+            return;
+        }
+    }
+}
+
+static void inserirArcoHierarquia(BufferArcosHierarquia *buffer, int origem, const ArcoContracao *arco) {
+    if (buffer->numArcos == buffer->capacidade) {
+        buffer->capacidade = buffer->capacidade > 0 ? buffer->capacidade * 2 : 1024;
+        buffer->origens = (int *)realloc(buffer->origens, (size_t)buffer->capacidade * sizeof(int));
+        buffer->destinos = (int *)realloc(buffer->destinos, (size_t)buffer->capacidade * sizeof(int));
+        buffer->pesos = (double *)realloc(buffer->pesos, (size_t)buffer->capacidade * sizeof(double));
+        buffer->meios = (int *)realloc(buffer->meios, (size_t)buffer->capacidade * sizeof(int));
+        if (!buffer->origens || !buffer->destinos || !buffer->pesos || !buffer->meios) {
+            fprintf(stderr, "Erro ao alocar memória para os arcos da hierarquia\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    buffer->origens[buffer->numArcos] = origem;
+    buffer->destinos[buffer->numArcos] = arco->vizinho;
+    buffer->pesos[buffer->numArcos] = arco->peso;
+    buffer->meios[buffer->numArcos] = arco->meio;
+    buffer->numArcos++;
+}
+
+// Converte os arcos gravados para CSR (ordenação por contagem das origens)
+static GrafoCSR *construirCSRHierarquia(const BufferArcosHierarquia *buffer, int numVertices, int **meios) {
+    GrafoCSR *csr = criarGrafoCSR(numVertices, buffer->numArcos);
+    *meios = (int *)malloc((size_t)(buffer->numArcos > 0 ? buffer->numArcos : 1) * sizeof(int));
+    long long *posicao = (long long *)malloc((size_t)(numVertices > 0 ? numVertices : 1) * sizeof(long long));
+    if (!*meios || !posicao) {
+        fprintf(stderr, "Erro ao alocar memória para a hierarquia\n");
+        exit(EXIT_FAILURE);
+    }
+    for (long long i = 0; i < buffer->numArcos; i++) {
+        csr->inicio[buffer->origens[i] + 1]++;
+    }
+    for (int v = 0; v < numVertices; v++) {
+        csr->inicio[v + 1] += csr->inicio[v];
+        posicao[v] = csr->inicio[v];
+    }
+    for (long long i = 0; i < buffer->numArcos; i++) {
+        long long p = posicao[buffer->origens[i]]++;
+        csr->destinos[p] = buffer->destinos[i];
+        csr->pesos[p] = buffer->pesos[i];
+        (*meios)[p] = buffer->meios[i];
+    }
+    free(posicao);
+    return csr;
+}
+
+// Dijkstra local a partir de origem pelos vértices ainda não contraídos, sem passar por
+// ignorado, até finalizar os numAlvos vértices marcados na rodada atual, passar da
+// distância limite ou finalizar LIMITE_BUSCA_TESTEMUNHA vértices.
+// distancias[x] é um limite superior válido para todo x marcado na geração atual.
+static void buscarTestemunhas(EstadoContracao *estado, int origem, int ignorado, double limite, int numAlvos) {
+    EspacoTrabalho *espaco = estado->espaco;
+    double *distancias = estado->distancias;
+    iniciarBuscaEspaco(espaco, estado->numVertices);
+    unsigned int geracao = espaco->geracao;
+    unsigned int *alcancados = espaco->marcas;
+    HeapIndexado *heap = obterHeapEspaco(espaco);
+    heap->tamanho = 0;
+
+    alcancados[origem] = geracao;
+    distancias[origem] = 0.0;
+    inserirHeapIndexado(heap, origem, 0.0);
+    int finalizados = 0;
+    while (heap->tamanho > 0 && finalizados < LIMITE_BUSCA_TESTEMUNHA) {
+        ItemHeap item = extrairMinimoHeapIndexado(heap);
+        if (item.chave > limite) {
+            break;
+        }
+        finalizados++;
+        if (estado->marcasAlvo[item.vertice] == estado->rodadaAlvo && --numAlvos == 0) {
+            break;
+        }
+        ListaArcos *saidas = &estado->saidas[item.vertice];
+        for (int i = 0; i < saidas->tamanho; i++) {
+            int x = saidas->arcos[i].vizinho;
+            if (x == ignorado) {
+                continue;
+            }
+            double novaDistancia = item.chave + saidas->arcos[i].peso;
+            if (alcancados[x] != geracao) {
+                alcancados[x] = geracao;
+                distancias[x] = novaDistancia;
+                inserirHeapIndexado(heap, x, novaDistancia);
+            } else if (heap->posicoes[x] >= 0 && novaDistancia < distancias[x]) {
+                distancias[x] = novaDistancia;
+                diminuirChaveHeapIndexado(heap, x, novaDistancia);
+            }
+        }
+    }
+}
+
+// Conta os atalhos necessários para contrair v e, se contrair for verdadeiro, insere-os.
+// As listas só contêm vizinhos ainda não contraídos.
+static int processarAtalhos(EstadoContracao *estado, int v, int contrair) {
+    ListaArcos *entradas = &estado->entradas[v];
+    ListaArcos *saidas = &estado->saidas[v];
+    unsigned int *alcancados = estado->espaco->marcas;
+    int atalhos = 0;
+
+    for (int i = 0; i < entradas->tamanho; i++) {
+        int u = entradas->arcos[i].vizinho;
+        double pesoEntrada = entradas->arcos[i].peso;
+        double maiorSaida = -1.0;
+        int numAlvos = 0;
+        if (++estado->rodadaAlvo == 0) {
+            memset(estado->marcasAlvo, 0, (size_t)estado->numVertices * sizeof(unsigned int));
+            estado->rodadaAlvo = 1;
+        }
+        for (int j = 0; j < saidas->tamanho; j++) {
+            if (saidas->arcos[j].vizinho != u) {
+                estado->marcasAlvo[saidas->arcos[j].vizinho] = estado->rodadaAlvo;
+                numAlvos++;
+                if (saidas->arcos[j].peso > maiorSaida) {
+                    maiorSaida = saidas->arcos[j].peso;
+                }
+            }
+        }
+        if (numAlvos == 0) {
+            continue;
+        }
+
+        buscarTestemunhas(estado, u, v, pesoEntrada + maiorSaida, numAlvos);
+        unsigned int geracao = estado->espaco->geracao;
+        for (int j = 0; j < saidas->tamanho; j++) {
+            int x = saidas->arcos[j].vizinho;
+            if (x == u) {
+                continue;
+            }
+            double pesoAtalho = pesoEntrada + saidas->arcos[j].peso;
+            if (alcancados[x] == geracao && estado->distancias[x] <= pesoAtalho) {
+                continue; // Existe testemunha que não passa por v
+            }
+            atalhos++;
+            if (contrair) {
+                inserirOuReduzirArco(&estado->saidas[u], x, pesoAtalho, v);
+                inserirOuReduzirArco(&estado->entradas[x], u, pesoAtalho, v);
+            }
+        }
+    }
+    return atalhos;
+}
+
+static double calcularPrioridade(EstadoContracao *estado, int v) {
+    int atalhos = processarAtalhos(estado, v, 0);
+    return (double)atalhos - estado->entradas[v].tamanho - estado->saidas[v].tamanho +
+           estado->vizinhosContraidos[v];
+}
+
+// Troca a chave de v no heap (aumento ou redução)
+static void alterarChaveHeap(HeapIndexado *heap, int v, double chave) {
+    int i = heap->posicoes[v];
+    heap->itens[i].chave = chave;
+    subirHeapIndexado(heap, i);
+    descerHeapIndexado(heap, heap->posicoes[v]);
+}
+
+// Só o termo de vizinhos contraídos é atualizado aqui; a diferença de arestas é
+// recalculada quando o vértice chega ao topo da fila
+static void atualizarVizinhoContraido(EstadoContracao *estado, HeapIndexado *fila, int x) {
+    estado->vizinhosContraidos[x]++;
+    alterarChaveHeap(fila, x, fila->itens[fila->posicoes[x]].chave + 1.0);
+}
+
+// Aloca o estado das consultas (comum à construção e à leitura do arquivo)
+static void alocarEstadoConsultas(HierarquiaContracao *hierarquia) {
+    int n = hierarquia->numVertices;
+    hierarquia->espacoIda = criarEspacoTrabalho(n);
+    hierarquia->espacoVolta = criarEspacoTrabalho(n);
+    hierarquia->distanciasIda = (double *)malloc((size_t)(n > 0 ? n : 1) * sizeof(double));
+    hierarquia->distanciasVolta = (double *)malloc((size_t)(n > 0 ? n : 1) * sizeof(double));
+    hierarquia->arcosIda = (long long *)malloc((size_t)(n > 0 ? n : 1) * sizeof(long long));
+    hierarquia->arcosVolta = (long long *)malloc((size_t)(n > 0 ? n : 1) * sizeof(long long));
+    if (!hierarquia->distanciasIda || !hierarquia->distanciasVolta || !hierarquia->arcosIda ||
+        !hierarquia->arcosVolta) {
+        fprintf(stderr, "Erro ao alocar memória para as consultas da hierarquia\n");
+        exit(EXIT_FAILURE);
+    }
+    hierarquia->numVisitados = 0;
+}
+
+HierarquiaContracao *criarHierarquiaContracao(Grafo *grafo) {
+    GrafoCSR *csr = obterCSR(grafo);
+    int n = csr->numVertices;
+
+    EstadoContracao estado;
+    estado.numVertices = n;
+    estado.saidas = (ListaArcos *)calloc((size_t)(n > 0 ? n : 1), sizeof(ListaArcos));
+    estado.entradas = (ListaArcos *)calloc((size_t)(n > 0 ? n : 1), sizeof(ListaArcos));
+    estado.vizinhosContraidos = (int *)calloc((size_t)(n > 0 ? n : 1), sizeof(int));
+    estado.distancias = (double *)malloc((size_t)(n > 0 ? n : 1) * sizeof(double));
+    estado.marcasAlvo = (unsigned int *)calloc((size_t)(n > 0 ? n : 1), sizeof(unsigned int));
+    estado.rodadaAlvo = 0;
+    estado.espaco = criarEspacoTrabalho(n);
+    HierarquiaContracao *hierarquia = (HierarquiaContracao *)malloc(sizeof(HierarquiaContracao));
+    if (!estado.saidas || !estado.entradas || !estado.vizinhosContraidos || !estado.distancias || !estado.marcasAlvo || !hierarquia) {
+        fprintf(stderr, "Erro ao alocar memória para a hierarquia de contração\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Laços são descartados e arcos paralelos ficam com o menor peso
+    for (int u = 0; u < n; u++) {
+        for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+            int v = csr->destinos[e];
+            if (v != u) {
+                inserirOuReduzirArco(&estado.saidas[u], v, csr->pesos[e], -1);
+                inserirOuReduzirArco(&estado.entradas[v], u, csr->pesos[e], -1);
+            }
+        }
+    }
+
+    hierarquia->numVertices = n;
+    hierarquia->nivel = (int *)malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    hierarquia->idsExternos = NULL;
+    const long long *ids = obterIdsExternos(grafo);
+    if (ids != NULL) {
+        hierarquia->idsExternos = (long long *)malloc((size_t)n * sizeof(long long));
+        if (hierarquia->idsExternos) {
+            memcpy(hierarquia->idsExternos, ids, (size_t)n * sizeof(long long));
+        }
+    }
+    if (!hierarquia->nivel || (ids != NULL && !hierarquia->idsExternos)) {
+        fprintf(stderr, "Erro ao alocar memória para a hierarquia de contração\n");
+        exit(EXIT_FAILURE);
+    }
+
+    HeapIndexado *fila = criarHeapIndexado(n > 0 ? n : 1);
+    for (int v = 0; v < n; v++) {
+        inserirHeapIndexado(fila, v, calcularPrioridade(&estado, v));
+    }
+
+    BufferArcosHierarquia subida = {NULL, NULL, NULL, NULL, 0, 0};
+    BufferArcosHierarquia descida = {NULL, NULL, NULL, NULL, 0, 0};
+    int proximoNivel = 0;
+    while (fila->tamanho > 0) {
+        // Atualização preguiçosa: a prioridade do mínimo é recalculada e, se tiver
+        // piorado além da do próximo, o vértice volta para a fila
+        ItemHeap item = extrairMinimoHeapIndexado(fila);
+        int v = item.vertice;
+        double prioridade = calcularPrioridade(&estado, v);
+        if (fila->tamanho > 0 && prioridade > fila->itens[0].chave) {
+            inserirHeapIndexado(fila, v, prioridade);
+            continue;
+        }
+
+        hierarquia->nivel[v] = proximoNivel++;
+        ListaArcos *saidas = &estado.saidas[v];
+        ListaArcos *entradas = &estado.entradas[v];
+        for (int i = 0; i < saidas->tamanho; i++) {
+            inserirArcoHierarquia(&subida, v, &saidas->arcos[i]);
+        }
+        for (int i = 0; i < entradas->tamanho; i++) {
+            inserirArcoHierarquia(&descida, v, &entradas->arcos[i]);
+        }
+
+        processarAtalhos(&estado, v, 1);
+
+        for (int i = 0; i < saidas->tamanho; i++) {
+            removerArco(&estado.entradas[saidas->arcos[i].vizinho], v);
+        }
+        for (int i = 0; i < entradas->tamanho; i++) {
+            removerArco(&estado.saidas[entradas->arcos[i].vizinho], v);
+        }
+        for (int i = 0; i < saidas->tamanho; i++) {
+            atualizarVizinhoContraido(&estado, fila, saidas->arcos[i].vizinho);
+        }
+        for (int i = 0; i < entradas->tamanho; i++) {
+            atualizarVizinhoContraido(&estado, fila, entradas->arcos[i].vizinho);
+        }
+        free(saidas->arcos);
+        free(entradas->arcos);
+        saidas->arcos = NULL;
+        entradas->arcos = NULL;
+        saidas->tamanho = saidas->capacidade = 0;
+        entradas->tamanho = entradas->capacidade = 0;
+    }
+
+    hierarquia->subida = construirCSRHierarquia(&subida, n, &hierarquia->meiosSubida);
+    hierarquia->descida = construirCSRHierarquia(&descida, n, &hierarquia->meiosDescida);
+    alocarEstadoConsultas(hierarquia);
+
+    free(subida.origens);
+    free(subida.destinos);
+    free(subida.pesos);
+    free(subida.meios);
+    free(descida.origens);
+    free(descida.destinos);
+    free(descida.pesos);
+    free(descida.meios);
+    liberarHeapIndexado(fila);
+    liberarEspacoTrabalho(estado.espaco);
+    free(estado.saidas);
+    free(estado.entradas);
+    free(estado.vizinhosContraidos);
+    free(estado.distancias);
+    free(estado.marcasAlvo);
+    return hierarquia;
+}
+
+void liberarHierarquiaContracao(HierarquiaContracao *hierarquia) {
+    free(hierarquia->nivel);
+    free(hierarquia->idsExternos);
+    liberarGrafoCSR(hierarquia->subida);
+    liberarGrafoCSR(hierarquia->descida);
+    free(hierarquia->meiosSubida);
+    free(hierarquia->meiosDescida);
+    liberarEspacoTrabalho(hierarquia->espacoIda);
+    liberarEspacoTrabalho(hierarquia->espacoVolta);
+    free(hierarquia->distanciasIda);
+    free(hierarquia->distanciasVolta);
+    free(hierarquia->arcosIda);
+    free(hierarquia->arcosVolta);
+    free(hierarquia);
+}
+
+static void escreverArcosBinarios(BufferSaida *buffer, const GrafoCSR *csr, const int *meios) {
+    int64_t m = csr->numArestas;
+    escreverBytes(buffer, &m, sizeof(m));
+    for (int v = 0; v <= csr->numVertices; v++) {
+        int64_t inicio = csr->inicio[v];
+        escreverBytes(buffer, &inicio, sizeof(inicio));
+    }
+    for (long long e = 0; e < csr->numArestas; e++) {
+        int32_t destino = csr->destinos[e];
+        escreverBytes(buffer, &destino, sizeof(destino));
+    }
+    escreverBytes(buffer, csr->pesos, (size_t)csr->numArestas * sizeof(double));
+    for (long long e = 0; e < csr->numArestas; e++) {
+        int32_t meio = meios[e];
+        escreverBytes(buffer, &meio, sizeof(meio));
+    }
+}
+
+int salvarHierarquiaContracao(const HierarquiaContracao *hierarquia, const char *nomeArquivo) {
+    FILE *arquivo = fopen(nomeArquivo, "wb");
+    if (!arquivo) {
+        printf("Erro ao criar o arquivo %s.\n", nomeArquivo);
+        return 0;
+    }
+    BufferSaida *buffer = criarBufferSaida(arquivo, TAMANHO_BUFFER_SAIDA);
+    int32_t n = hierarquia->numVertices;
+    escreverBytes(buffer, MAGICO_HIERARQUIA, 4);
+    escreverBytes(buffer, &n, sizeof(n));
+    for (int v = 0; v < hierarquia->numVertices; v++) {
+        int32_t nivel = hierarquia->nivel[v];
+        escreverBytes(buffer, &nivel, sizeof(nivel));
+    }
+    escreverArcosBinarios(buffer, hierarquia->subida, hierarquia->meiosSubida);
+    escreverArcosBinarios(buffer, hierarquia->descida, hierarquia->meiosDescida);
+    if (hierarquia->idsExternos != NULL) {
+        escreverBytes(buffer, MAGICO_IDS, 4);
+        escreverBytes(buffer, hierarquia->idsExternos, (size_t)hierarquia->numVertices * sizeof(long long));
+    }
+    liberarBufferSaida(buffer);
+    int ok = !ferror(arquivo);
+    if (fclose(arquivo) != 0 || !ok) {
+        printf("Erro ao gravar o arquivo %s.\n", nomeArquivo);
+        return 0;
+    }
+    return 1;
+}
+
+// Lê inteiros de 32 bits para um vetor de int
+static int lerInteiros32(FILE *arquivo, int *destino, long long quantidade) {
+    for (long long i = 0; i < quantidade; i++) {
+        int32_t valor;
+        if (fread(&valor, sizeof(valor), 1, arquivo) != 1) {
+            return 0;
+        }
+        destino[i] = valor;
+    }
+    return 1;
+}
+
+// Lê um conjunto de arcos validando a estrutura do CSR; retorna NULL se inválido
+static GrafoCSR *lerArcosBinarios(FILE *arquivo, int numVertices, int **meios) {
+    int64_t m;
+    if (fread(&m, sizeof(m), 1, arquivo) != 1 || m < 0) {
+        return NULL;
+    }
+    GrafoCSR *csr = criarGrafoCSR(numVertices, m);
+    *meios = (int *)malloc((size_t)(m > 0 ? m : 1) * sizeof(int));
+    if (!*meios) {
+        fprintf(stderr, "Erro ao alocar memória para a hierarquia\n");
+        exit(EXIT_FAILURE);
+    }
+    int valido = 1;
+    for (int v = 0; v <= numVertices && valido; v++) {
+        int64_t inicio;
+        valido = fread(&inicio, sizeof(inicio), 1, arquivo) == 1 && inicio >= 0 && inicio <= m &&
+                 (v == 0 ? inicio == 0 : inicio >= csr->inicio[v - 1]);
+        csr->inicio[v] = inicio;
+    }
+    valido = valido && csr->inicio[numVertices] == m && lerInteiros32(arquivo, csr->destinos, m) &&
+             fread(csr->pesos, sizeof(double), (size_t)m, arquivo) == (size_t)m &&
+             lerInteiros32(arquivo, *meios, m);
+    for (long long e = 0; e < m && valido; e++) {
+        valido = csr->destinos[e] >= 0 && csr->destinos[e] < numVertices && (*meios)[e] >= -1 &&
+                 (*meios)[e] < numVertices;
+    }
+    if (!valido) {
+        liberarGrafoCSR(csr);
+        free(*meios);
+        *meios = NULL;
+        return NULL;
+    }
+    return csr;
+}
+
+HierarquiaContracao *carregarHierarquiaContracao(const char *nomeArquivo) {
+    FILE *arquivo = fopen(nomeArquivo, "rb");
+    if (!arquivo) {
+        printf("Erro ao abrir o arquivo %s.\n", nomeArquivo);
+        return NULL;
+    }
+    char magico[4];
+    int32_t n;
+    if (fread(magico, 1, 4, arquivo) != 4 || memcmp(magico, MAGICO_HIERARQUIA, 4) != 0 ||
+        fread(&n, sizeof(n), 1, arquivo) != 1 || n < 0) {
+        printf("Erro: %s não contém uma hierarquia de contração.\n", nomeArquivo);
+        fclose(arquivo);
+        return NULL;
+    }
+
+    HierarquiaContracao *hierarquia = (HierarquiaContracao *)malloc(sizeof(HierarquiaContracao));
+    if (!hierarquia) {
+        fprintf(stderr, "Erro ao alocar memória para a hierarquia de contração\n");
+        exit(EXIT_FAILURE);
+    }
+    hierarquia->numVertices = n;
+    hierarquia->idsExternos = NULL;
+    hierarquia->subida = NULL;
+    hierarquia->descida = NULL;
+    hierarquia->meiosSubida = NULL;
+    hierarquia->meiosDescida = NULL;
+    hierarquia->nivel = (int *)malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    if (!hierarquia->nivel) {
+        fprintf(stderr, "Erro ao alocar memória para a hierarquia de contração\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int valido = lerInteiros32(arquivo, hierarquia->nivel, n);
+    if (valido) {
+        hierarquia->subida = lerArcosBinarios(arquivo, n, &hierarquia->meiosSubida);
+        valido = hierarquia->subida != NULL;
+    }
+    if (valido) {
+        hierarquia->descida = lerArcosBinarios(arquivo, n, &hierarquia->meiosDescida);
+        valido = hierarquia->descida != NULL;
+    }
+    // Depois dos arcos só pode vir uma seção "GRFI" completa; bytes soltos invalidam o arquivo
+    size_t lidos = valido ? fread(magico, 1, 4, arquivo) : 0;
+    if (lidos == 4) {
+        hierarquia->idsExternos = (long long *)malloc((size_t)(n > 0 ? n : 1) * sizeof(long long));
+        if (!hierarquia->idsExternos) {
+            fprintf(stderr, "Erro ao alocar memória para a hierarquia de contração\n");
+            exit(EXIT_FAILURE);
+        }
+        valido = memcmp(magico, MAGICO_IDS, 4) == 0 &&
+                 fread(hierarquia->idsExternos, sizeof(long long), (size_t)n, arquivo) == (size_t)n;
+    } else if (lidos > 0) {
+        valido = 0;
+    }
+    valido = valido && fgetc(arquivo) == EOF;
+    fclose(arquivo);
+
+    if (!valido) {
+        printf("Erro: arquivo de hierarquia de contração %s inválido.\n", nomeArquivo);
+        free(hierarquia->nivel);
+        free(hierarquia->idsExternos);
+        if (hierarquia->subida != NULL) {
+            liberarGrafoCSR(hierarquia->subida);
+            free(hierarquia->meiosSubida);
+        }
+        if (hierarquia->descida != NULL) {
+            liberarGrafoCSR(hierarquia->descida);
+            free(hierarquia->meiosDescida);
+        }
+        free(hierarquia);
+        return NULL;
+    }
+    alocarEstadoConsultas(hierarquia);
+    return hierarquia;
+}
+
+// Meio do arco u -> x guardado em csr a partir de u (há no máximo um por par)
+static int buscarMeioArco(const GrafoCSR *csr, const int *meios, int u, int x) {
+    for (long long e = csr->inicio[u]; e < csr->inicio[u + 1]; e++) {
+        if (csr->destinos[e] == x) {
+            return meios[e];
+        }
+    }
+    return -1;
+}
+
+// Vetor dinâmico de triplas (origem, destino, meio) para desempacotar atalhos
+typedef struct {
+    int *dados;
+    int tamanho;
+    int capacidade;
+} PilhaAtalhos;
+
+static void empilharAtalho(PilhaAtalhos *pilha, int a, int b, int meio) {
+    if (pilha->tamanho + 3 > pilha->capacidade) {
+        pilha->capacidade = pilha->capacidade > 0 ? pilha->capacidade * 2 : 96;
+        pilha->dados = (int *)realloc(pilha->dados, (size_t)pilha->capacidade * sizeof(int));
+        if (!pilha->dados) {
+            fprintf(stderr, "Erro ao alocar memória para desempacotar o caminho\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    pilha->dados[pilha->tamanho++] = a;
+    pilha->dados[pilha->tamanho++] = b;
+    pilha->dados[pilha->tamanho++] = meio;
+}
+
+// Acrescenta ao caminho os vértices do arco a -> b após a (inclusive b). O atalho
+// a -> b com meio m equivale a a -> m (guardado na descida de m) seguido de m -> b
+// (guardado na subida de m).
+static void desempacotarArco(const HierarquiaContracao *hierarquia, PilhaAtalhos *pilha, int a, int b, int meio,
+                             long long *caminho, int *tamanho) {
+    pilha->tamanho = 0;
+    empilharAtalho(pilha, a, b, meio);
+    while (pilha->tamanho > 0) {
+        int m = pilha->dados[--pilha->tamanho];
+        int y = pilha->dados[--pilha->tamanho];
+        int x = pilha->dados[--pilha->tamanho];
+        if (m == -1) {
+            caminho[(*tamanho)++] = hierarquia->idsExternos != NULL ? hierarquia->idsExternos[y] : y + 1;
+            continue;
+        }
+        // O segundo trecho é empilhado primeiro para sair depois
+        empilharAtalho(pilha, m, y, buscarMeioArco(hierarquia->subida, hierarquia->meiosSubida, m, y));
+        empilharAtalho(pilha, x, m, buscarMeioArco(hierarquia->descida, hierarquia->meiosDescida, m, x));
+    }
+}
+
+// Finaliza o mínimo de uma das buscas e relaxa seus arcos de subida. Atualiza a melhor
+// distância e o vértice de encontro quando o vértice já foi alcançado pela outra busca.
+// Stall-on-demand: se um vértice de nível maior já alcançado chega a u por um arco
+// contrário (opostos) com distância menor, a distância de u não é exata e u não é expandido.
+static void avancarBuscaHierarquia(const GrafoCSR *arcos, const GrafoCSR *opostos, EspacoTrabalho *espaco,
+                                   double *distancias, long long *arcosUsados, const EspacoTrabalho *outroEspaco,
+                                   const double *outrasDistancias, double *melhor, int *encontro) {
+    unsigned int geracao = espaco->geracao;
+    unsigned int *alcancados = espaco->marcas;
+    HeapIndexado *heap = espaco->heap;
+    int u = extrairMinimoHeapIndexado(heap).vertice;
+
+    for (long long e = opostos->inicio[u]; e < opostos->inicio[u + 1]; e++) {
+        int x = opostos->destinos[e];
+        if (alcancados[x] == geracao && distancias[x] + opostos->pesos[e] < distancias[u]) {
+            return;
+        }
+    }
+
+    if (outroEspaco->marcas[u] == outroEspaco->geracao && distancias[u] + outrasDistancias[u] < *melhor) {
+        *melhor = distancias[u] + outrasDistancias[u];
+        *encontro = u;
+    }
+    for (long long e = arcos->inicio[u]; e < arcos->inicio[u + 1]; e++) {
+        int x = arcos->destinos[e];
+        double novaDistancia = distancias[u] + arcos->pesos[e];
+        if (alcancados[x] != geracao) {
+            alcancados[x] = geracao;
+            distancias[x] = novaDistancia;
+            arcosUsados[x] = e;
+            inserirHeapIndexado(heap, x, novaDistancia);
+        } else if (heap->posicoes[x] >= 0 && novaDistancia < distancias[x]) {
+            distancias[x] = novaDistancia;
+            arcosUsados[x] = e;
+            diminuirChaveHeapIndexado(heap, x, novaDistancia);
+        }
+    }
+}
+
+static void iniciarBuscaHierarquia(EspacoTrabalho *espaco, int numVertices, int origem, double *distancias,
+                                   long long *arcosUsados) {
+    iniciarBuscaEspaco(espaco, numVertices);
+    HeapIndexado *heap = obterHeapEspaco(espaco);
+    heap->tamanho = 0;
+    espaco->marcas[origem] = espaco->geracao;
+    distancias[origem] = 0.0;
+    arcosUsados[origem] = -1;
+    inserirHeapIndexado(heap, origem, 0.0);
+}
+
+// Vértice de origem de um arco do CSR (busca binária em inicio)
+static int origemArco(const GrafoCSR *csr, long long e) {
+    int baixo = 0, alto = csr->numVertices - 1;
+    while (baixo < alto) {
+        int meio = baixo + (alto - baixo + 1) / 2;
+        if (csr->inicio[meio] <= e) {
+            baixo = meio;
+        } else {
+            alto = meio - 1;
+        }
+    }
+    return baixo;
+}
+
+double consultarHierarquiaContracao(HierarquiaContracao *hierarquia, int origem, int destino,
+                                    long long *caminho, int *tamanhoCaminho) {
+    int n = hierarquia->numVertices;
+    EspacoTrabalho *ida = hierarquia->espacoIda;
+    EspacoTrabalho *volta = hierarquia->espacoVolta;
+
+    iniciarBuscaHierarquia(ida, n, origem, hierarquia->distanciasIda, hierarquia->arcosIda);
+    iniciarBuscaHierarquia(volta, n, destino, hierarquia->distanciasVolta, hierarquia->arcosVolta);
+
+    // Cada busca para quando o seu mínimo não pode mais melhorar o melhor encontro
+    double melhor = DBL_MAX;
+    int encontro = -1;
+    hierarquia->numVisitados = 0;
+    while (1) {
+        int idaAtiva = ida->heap->tamanho > 0 && ida->heap->itens[0].chave < melhor;
+        int voltaAtiva = volta->heap->tamanho > 0 && volta->heap->itens[0].chave < melhor;
+        if (!idaAtiva && !voltaAtiva) {
+            break;
+        }
+        if (idaAtiva && (!voltaAtiva || ida->heap->itens[0].chave <= volta->heap->itens[0].chave)) {
+            avancarBuscaHierarquia(hierarquia->subida, hierarquia->descida, ida, hierarquia->distanciasIda, hierarquia->arcosIda, volta,
+                                   hierarquia->distanciasVolta, &melhor, &encontro);
+        } else {
+            avancarBuscaHierarquia(hierarquia->descida, hierarquia->subida, volta, hierarquia->distanciasVolta, hierarquia->arcosVolta, ida,
+                                   hierarquia->distanciasIda, &melhor, &encontro);
+        }
+        hierarquia->numVisitados++;
+    }
+
+    if (tamanhoCaminho != NULL) {
+        *tamanhoCaminho = 0;
+    }
+    if (encontro == -1 || caminho == NULL) {
+        return melhor;
+    }
+
+    // Arcos de subida da origem até o encontro (coletados de trás para frente)
+    int numArcosIda = 0;
+    for (int v = encontro; hierarquia->arcosIda[v] != -1; numArcosIda++) {
+        v = origemArco(hierarquia->subida, hierarquia->arcosIda[v]);
+    }
+    long long *arcos = (long long *)malloc((size_t)(numArcosIda > 0 ? numArcosIda : 1) * sizeof(long long));
+    if (!arcos) {
+        fprintf(stderr, "Erro ao alocar memória para o caminho\n");
+        exit(EXIT_FAILURE);
+    }
+    int i = numArcosIda;
+    for (int v = encontro; hierarquia->arcosIda[v] != -1;) {
+        arcos[--i] = hierarquia->arcosIda[v];
+        v = origemArco(hierarquia->subida, hierarquia->arcosIda[v]);
+    }
+
+    PilhaAtalhos pilha = {NULL, 0, 0};
+    int tamanho = 0;
+    caminho[tamanho++] = hierarquia->idsExternos != NULL ? hierarquia->idsExternos[origem] : origem + 1;
+    for (i = 0; i < numArcosIda; i++) {
+        long long e = arcos[i];
+        desempacotarArco(hierarquia, &pilha, origemArco(hierarquia->subida, e), hierarquia->subida->destinos[e],
+                         hierarquia->meiosSubida[e], caminho, &tamanho);
+    }
+    // Arcos de descida do encontro até o destino: cada arco guardado em v aponta para o
+    // vértice anterior no caminho, então o arco real vai de destinos[e] para v
+    for (int v = encontro; hierarquia->arcosVolta[v] != -1;) {
+        long long e = hierarquia->arcosVolta[v];
+        int proximo = origemArco(hierarquia->descida, e);
+        desempacotarArco(hierarquia, &pilha, v, proximo, hierarquia->meiosDescida[e], caminho, &tamanho);
+        v = proximo;
+    }
+    free(pilha.dados);
+    free(arcos);
+    if (tamanhoCaminho != NULL) {
+        *tamanhoCaminho = tamanho;
+    }
+    return melhor;
+}
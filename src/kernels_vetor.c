@@ -0,0 +1,199 @@
+#include "../include/kernels_vetor.h"
+#include <float.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define KERNELS_VETOR_X86 1
+#include <immintrin.h>
+#else
+#define KERNELS_VETOR_X86 0
+#endif
+
+NivelKernelVetor detectarKernelVetor(void) {
+#if KERNELS_VETOR_X86
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2")) {
+        return KERNEL_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return KERNEL_AVX2;
+    }
+#endif
+    return KERNEL_ESCALAR;
+}
+
+// Varredura escalar a partir de inicio, continuando do mínimo já encontrado. Como os
+// índices crescem, a comparação estrita mantém o primeiro índice entre os empatados.
+static int minimoEscalar(const double *distancia, const unsigned int *marcas, unsigned int geracao,
+                         int inicio, int numVertices, int u, double minimo) {
+    for (int v = inicio; v < numVertices; v++) {
+        if (marcas[v] != geracao && distancia[v] < minimo) {
+            minimo = distancia[v];
+            u = v;
+        }
+    }
+    return u;
+}
+
+static void relaxarEscalar(const double *pesos, int u, double *distancia, int *pais, const unsigned int *marcas,
+                           unsigned int geracao, int inicio, int numVertices) {
+    double distanciaU = distancia[u];
+    for (int v = inicio; v < numVertices; v++) {
+        if (pesos[v] > 0 && marcas[v] != geracao && distanciaU + pesos[v] < distancia[v]) {
+            distancia[v] = distanciaU + pesos[v];
+            pais[v] = u;
+        }
+    }
+}
+
+#if KERNELS_VETOR_X86
+// Combina o mínimo de cada pista (índices guardados como double, exatos até 2^53): menor
+// valor e, entre valores iguais, menor índice, como na varredura escalar
+static int reduzirPistas(const double *valores, const double *indices, int numPistas, double *minimo) {
+    int u = -1;
+    *minimo = DBL_MAX;
+    for (int p = 0; p < numPistas; p++) {
+        if (valores[p] < *minimo || (valores[p] == *minimo && valores[p] < DBL_MAX && (int)indices[p] < u)) {
+            *minimo = valores[p];
+            u = (int)indices[p];
+        }
+    }
+    return u;
+}
+
+// Cada pista guarda o primeiro índice do seu menor valor; os visitados viram DBL_MAX e
+// nunca passam na comparação estrita
+__attribute__((target("avx2")))
+static int minimoAvx2(const double *distancia, const unsigned int *marcas, unsigned int geracao, int numVertices) {
+    const __m256d infinito = _mm256_set1_pd(DBL_MAX);
+    const __m256d passo = _mm256_set1_pd(4.0);
+    const __m128i geracaoVetor = _mm_set1_epi32((int)geracao);
+    __m256d melhorValor = infinito;
+    __m256d melhorIndice = _mm256_set1_pd(-1.0);
+    __m256d indice = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+    int v = 0;
+    for (; v + 4 <= numVertices; v += 4) {
+        __m128i marcasVetor = _mm_loadu_si128((const __m128i *)(marcas + v));
+        __m256d visitado = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm_cmpeq_epi32(marcasVetor, geracaoVetor)));
+        __m256d valor = _mm256_blendv_pd(_mm256_loadu_pd(distancia + v), infinito, visitado);
+        __m256d menor = _mm256_cmp_pd(valor, melhorValor, _CMP_LT_OQ);
+        melhorValor = _mm256_blendv_pd(melhorValor, valor, menor);
+        melhorIndice = _mm256_blendv_pd(melhorIndice, indice, menor);
+        indice = _mm256_add_pd(indice, passo);
+    }
+    double valores[4], indices[4], minimo;
+    _mm256_storeu_pd(valores, melhorValor);
+    _mm256_storeu_pd(indices, melhorIndice);
+    int u = reduzirPistas(valores, indices, 4, &minimo);
+    return minimoEscalar(distancia, marcas, geracao, v, numVertices, u, minimo);
+}
+
+// As melhorias são raras depois das primeiras rodadas: a linha de distâncias só é
+// escrita quando alguma pista melhora, e os pais pelos bits da máscara
+__attribute__((target("avx2")))
+static void relaxarAvx2(const double *pesos, int u, double *distancia, int *pais, const unsigned int *marcas,
+                        unsigned int geracao, int numVertices) {
+    const __m256d distanciaU = _mm256_set1_pd(distancia[u]);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m128i geracaoVetor = _mm_set1_epi32((int)geracao);
+    int v = 0;
+    for (; v + 4 <= numVertices; v += 4) {
+        __m256d peso = _mm256_loadu_pd(pesos + v);
+        __m256d atual = _mm256_loadu_pd(distancia + v);
+        __m256d nova = _mm256_add_pd(distanciaU, peso);
+        __m128i marcasVetor = _mm_loadu_si128((const __m128i *)(marcas + v));
+        __m256d visitado = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm_cmpeq_epi32(marcasVetor, geracaoVetor)));
+        __m256d melhora = _mm256_and_pd(_mm256_cmp_pd(peso, zero, _CMP_GT_OQ), _mm256_cmp_pd(nova, atual, _CMP_LT_OQ));
+        melhora = _mm256_andnot_pd(visitado, melhora);
+        int bits = _mm256_movemask_pd(melhora);
+        if (bits != 0) {
+            _mm256_storeu_pd(distancia + v, _mm256_blendv_pd(atual, nova, melhora));
+            for (; bits != 0; bits &= bits - 1) {
+                pais[v + __builtin_ctz((unsigned int)bits)] = u;
+            }
+        }
+    }
+    relaxarEscalar(pesos, u, distancia, pais, marcas, geracao, v, numVertices);
+}
+
+// Máscara de 8 bits dos vértices visitados entre v e v + 7
+__attribute__((target("avx512f,avx2")))
+static inline __mmask8 visitadosAvx512(const unsigned int *marcas, __m256i geracaoVetor, int v) {
+    __m256i marcasVetor = _mm256_loadu_si256((const __m256i *)(marcas + v));
+    return (__mmask8)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(marcasVetor, geracaoVetor)));
+}
+
+__attribute__((target("avx512f,avx2")))
+static int minimoAvx512(const double *distancia, const unsigned int *marcas, unsigned int geracao, int numVertices) {
+    const __m512d passo = _mm512_set1_pd(8.0);
+    const __m256i geracaoVetor = _mm256_set1_epi32((int)geracao);
+    __m512d melhorValor = _mm512_set1_pd(DBL_MAX);
+    __m512d melhorIndice = _mm512_set1_pd(-1.0);
+    __m512d indice = _mm512_setr_pd(0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0);
+    int v = 0;
+    for (; v + 8 <= numVertices; v += 8) {
+        __mmask8 naoVisitado = (__mmask8)~visitadosAvx512(marcas, geracaoVetor, v);
+        __m512d valor = _mm512_loadu_pd(distancia + v);
+        __mmask8 menor = _mm512_mask_cmp_pd_mask(naoVisitado, valor, melhorValor, _CMP_LT_OQ);
+        melhorValor = _mm512_mask_mov_pd(melhorValor, menor, valor);
+        melhorIndice = _mm512_mask_mov_pd(melhorIndice, menor, indice);
+        indice = _mm512_add_pd(indice, passo);
+    }
+    double valores[8], indices[8], minimo;
+    _mm512_storeu_pd(valores, melhorValor);
+    _mm512_storeu_pd(indices, melhorIndice);
+    int u = reduzirPistas(valores, indices, 8, &minimo);
+    return minimoEscalar(distancia, marcas, geracao, v, numVertices, u, minimo);
+}
+
+__attribute__((target("avx512f,avx2")))
+static void relaxarAvx512(const double *pesos, int u, double *distancia, int *pais, const unsigned int *marcas,
+                          unsigned int geracao, int numVertices) {
+    const __m512d distanciaU = _mm512_set1_pd(distancia[u]);
+    const __m512d zero = _mm512_setzero_pd();
+    const __m256i geracaoVetor = _mm256_set1_epi32((int)geracao);
+    int v = 0;
+    for (; v + 8 <= numVertices; v += 8) {
+        __m512d peso = _mm512_loadu_pd(pesos + v);
+        __m512d nova = _mm512_add_pd(distanciaU, peso);
+        __mmask8 candidato = (__mmask8)(_mm512_cmp_pd_mask(peso, zero, _CMP_GT_OQ) &
+                                        ~visitadosAvx512(marcas, geracaoVetor, v));
+        __mmask8 melhora = _mm512_mask_cmp_pd_mask(candidato, nova, _mm512_loadu_pd(distancia + v), _CMP_LT_OQ);
+        if (melhora != 0) {
+            _mm512_mask_storeu_pd(distancia + v, melhora, nova);
+            for (unsigned int bits = melhora; bits != 0; bits &= bits - 1) {
+                pais[v + __builtin_ctz(bits)] = u;
+            }
+        }
+    }
+    relaxarEscalar(pesos, u, distancia, pais, marcas, geracao, v, numVertices);
+}
+#endif
+
+int encontrarMinimoNaoVisitado(NivelKernelVetor nivel, const double *distancia, const unsigned int *marcas,
+                               unsigned int geracao, int numVertices) {
+#if KERNELS_VETOR_X86
+    if (nivel == KERNEL_AVX512) {
+        return minimoAvx512(distancia, marcas, geracao, numVertices);
+    }
+    if (nivel == KERNEL_AVX2) {
+        return minimoAvx2(distancia, marcas, geracao, numVertices);
+    }
+#endif
+    (void)nivel;
+    return minimoEscalar(distancia, marcas, geracao, 0, numVertices, -1, DBL_MAX);
+}
+
+void relaxarLinhaMatriz(NivelKernelVetor nivel, const double *pesos, int u, double *distancia, int *pais,
+                        const unsigned int *marcas, unsigned int geracao, int numVertices) {
+#if KERNELS_VETOR_X86
+    if (nivel == KERNEL_AVX512) {
+        relaxarAvx512(pesos, u, distancia, pais, marcas, geracao, numVertices);
+        return;
+    }
+    if (nivel == KERNEL_AVX2) {
+        relaxarAvx2(pesos, u, distancia, pais, marcas, geracao, numVertices);
+        return;
+    }
+#endif
+    (void)nivel;
+    relaxarEscalar(pesos, u, distancia, pais, marcas, geracao, 0, numVertices);
+}
@@ -0,0 +1,402 @@
+#include "../include/leitura.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+// Maior pré-alocação feita a partir da contagem declarada num cabeçalho: uma contagem
+// errada ou enorme não deve esgotar a memória antes de ler o arquivo; o buffer cresce
+// sob demanda além disso
+#define LIMITE_PREALOCACAO_ARESTAS (1LL << 20)
+
+BufferArestas *criarBufferArestas(long long capacidadeInicial) {
+    BufferArestas *buffer = (BufferArestas *)malloc(sizeof(BufferArestas));
+    if (!buffer) {
+        fprintf(stderr, "Erro ao alocar memória para o buffer de arestas\n");
+        exit(EXIT_FAILURE);
+    }
+    if (capacidadeInicial < 16) {
+        capacidadeInicial = 16;
+    }
+    buffer->origens = (int *)malloc((size_t)capacidadeInicial * sizeof(int));
+    buffer->destinos = (int *)malloc((size_t)capacidadeInicial * sizeof(int));
+    buffer->capacidades = (double *)malloc((size_t)capacidadeInicial * sizeof(double));
+    if (!buffer->origens || !buffer->destinos || !buffer->capacidades) {
+        fprintf(stderr, "Erro ao alocar memória para o buffer de arestas\n");
+        exit(EXIT_FAILURE);
+    }
+    buffer->numArestas = 0;
+    buffer->capacidade = capacidadeInicial;
+    return buffer;
+}
+
+void inserirArestaBuffer(BufferArestas *buffer, int u, int v, double capacidade) {
+    if (buffer->numArestas == buffer->capacidade) {
+        buffer->capacidade *= 2;
+        buffer->origens = (int *)realloc(buffer->origens, (size_t)buffer->capacidade * sizeof(int));
+        buffer->destinos = (int *)realloc(buffer->destinos, (size_t)buffer->capacidade * sizeof(int));
+        buffer->capacidades = (double *)realloc(buffer->capacidades, (size_t)buffer->capacidade * sizeof(double));
+        if (!buffer->origens || !buffer->destinos || !buffer->capacidades) {
+            fprintf(stderr, "Erro ao redimensionar o buffer de arestas\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    buffer->origens[buffer->numArestas] = u;
+    buffer->destinos[buffer->numArestas] = v;
+    buffer->capacidades[buffer->numArestas] = capacidade;
+    buffer->numArestas++;
+}
+
+void liberarBufferArestas(BufferArestas *buffer) {
+    free(buffer->origens);
+    free(buffer->destinos);
+    free(buffer->capacidades);
+    free(buffer);
+}
+
+// Ordenação estável (counting sort) das arestas pela chave dada, usando os vetores temporários
+static void ordenarArestasPorChave(BufferArestas *buffer, int usarOrigem, int numVertices,
+                                   long long *contagem, int *tmpOrigens, int *tmpDestinos, double *tmpCapacidades) {
+    const int *chave = usarOrigem ? buffer->origens : buffer->destinos;
+
+    for (int i = 0; i <= numVertices; i++) {
+        contagem[i] = 0;
+    }
+    for (long long i = 0; i < buffer->numArestas; i++) {
+        contagem[chave[i] + 1]++;
+    }
+    for (int i = 0; i < numVertices; i++) {
+        contagem[i + 1] += contagem[i];
+    }
+    for (long long i = 0; i < buffer->numArestas; i++) {
+        long long pos = contagem[chave[i]]++;
+        tmpOrigens[pos] = buffer->origens[i];
+        tmpDestinos[pos] = buffer->destinos[i];
+        tmpCapacidades[pos] = buffer->capacidades[i];
+    }
+
+    // Os vetores temporários passam a ser os dados do buffer
+    long long n = buffer->numArestas;
+    for (long long i = 0; i < n; i++) {
+        buffer->origens[i] = tmpOrigens[i];
+        buffer->destinos[i] = tmpDestinos[i];
+        buffer->capacidades[i] = tmpCapacidades[i];
+    }
+}
+
+// Normaliza as arestas do buffer em O(V + E): remove laços e funde arestas paralelas
+// (u, v) somando as capacidades. Em grafos não direcionados (u, v) e (v, u) são a mesma
+// aresta. Retorna o número de arestas removidas.
+long long normalizarArestas(BufferArestas *buffer, int numVertices, int direcionado) {
+    long long n = buffer->numArestas;
+    if (n == 0) {
+        return 0;
+    }
+
+    // Remove laços e, se não direcionado, coloca cada aresta na forma (menor, maior)
+    long long m = 0;
+    for (long long i = 0; i < n; i++) {
+        int u = buffer->origens[i];
+        int v = buffer->destinos[i];
+        if (u == v) {
+            continue;
+        }
+        if (!direcionado && u > v) {
+            int temp = u;
+            u = v;
+            v = temp;
+        }
+        buffer->origens[m] = u;
+        buffer->destinos[m] = v;
+        buffer->capacidades[m] = buffer->capacidades[i];
+        m++;
+    }
+    buffer->numArestas = m;
+
+    // Radix sort em duas passadas: por destino e depois (estável) por origem
+    long long *contagem = (long long *)malloc(((size_t)numVertices + 1) * sizeof(long long));
+    int *tmpOrigens = (int *)malloc((size_t)(m > 0 ? m : 1) * sizeof(int));
+    int *tmpDestinos = (int *)malloc((size_t)(m > 0 ? m : 1) * sizeof(int));
+    double *tmpCapacidades = (double *)malloc((size_t)(m > 0 ? m : 1) * sizeof(double));
+    if (!contagem || !tmpOrigens || !tmpDestinos || !tmpCapacidades) {
+        fprintf(stderr, "Erro ao alocar memória para a normalização das arestas\n");
+        exit(EXIT_FAILURE);
+    }
+    ordenarArestasPorChave(buffer, 0, numVertices, contagem, tmpOrigens, tmpDestinos, tmpCapacidades);
+    ordenarArestasPorChave(buffer, 1, numVertices, contagem, tmpOrigens, tmpDestinos, tmpCapacidades);
+    free(contagem);
+    free(tmpOrigens);
+    free(tmpDestinos);
+    free(tmpCapacidades);
+
+    // Funde as arestas paralelas, agora consecutivas
+    long long k = 0;
+    for (long long i = 0; i < m; i++) {
+        if (k > 0 && buffer->origens[k - 1] == buffer->origens[i] && buffer->destinos[k - 1] == buffer->destinos[i]) {
+            buffer->capacidades[k - 1] += buffer->capacidades[i];
+        } else {
+            buffer->origens[k] = buffer->origens[i];
+            buffer->destinos[k] = buffer->destinos[i];
+            buffer->capacidades[k] = buffer->capacidades[i];
+            k++;
+        }
+    }
+    buffer->numArestas = k;
+
+    return n - k;
+}
+
+// Cria o grafo e insere todas as arestas do buffer
+Grafo *construirGrafoDeArestas(BufferArestas *buffer, int numVertices, TipoRepresentacao tipo, int direcionado) {
+    Grafo *grafo = criarGrafo(numVertices, tipo, direcionado);
+    for (long long i = 0; i < buffer->numArestas; i++) {
+        adicionarArestaGrafo(grafo, buffer->origens[i], buffer->destinos[i], buffer->capacidades[i], direcionado);
+    }
+    return grafo;
+}
+
+// Lê um arquivo no formato "n" seguido de linhas "u v c", em que u e v são IDs
+// arbitrários de 64 bits. Os IDs são mapeados para índices densos 0..N-1 e o grafo
+// guarda o mapeamento para traduzir as saídas de volta.
+Grafo *lerGrafoIdsEsparsos(const char *nomeArquivo, TipoRepresentacao tipo, int direcionado,
+                           long long *arestasRemovidas) {
+    FILE *arquivo = fopen(nomeArquivo, "r");
+    if (!arquivo) {
+        printf("Erro ao abrir o arquivo %s.\n", nomeArquivo);
+        return NULL;
+    }
+
+    // O cabeçalho é usado apenas como estimativa do número de vértices
+    long long estimativaVertices;
+    if (fscanf(arquivo, "%lld", &estimativaVertices) != 1) {
+        printf("Erro ao ler o cabeçalho do arquivo %s.\n", nomeArquivo);
+        fclose(arquivo);
+        return NULL;
+    }
+    if (estimativaVertices < 0 || estimativaVertices > (1 << 30)) {
+        estimativaVertices = 0;
+    }
+
+    MapaVertices *mapa = criarMapaVertices((int)estimativaVertices);
+    BufferArestas *arestas = criarBufferArestas(estimativaVertices < LIMITE_PREALOCACAO_ARESTAS ? estimativaVertices
+                                                                                            : LIMITE_PREALOCACAO_ARESTAS);
+
+    long long idU, idV;
+    double capacidade;
+    while (fscanf(arquivo, "%lld %lld %lf", &idU, &idV, &capacidade) == 3) {
+        int u = obterOuInserirVertice(mapa, idU);
+        int v = obterOuInserirVertice(mapa, idV);
+        inserirArestaBuffer(arestas, u, v, capacidade);
+    }
+    fclose(arquivo);
+
+    if (mapa->tamanho == 0) {
+        printf("Erro: nenhuma aresta lida do arquivo %s.\n", nomeArquivo);
+        liberarBufferArestas(arestas);
+        liberarMapaVertices(mapa);
+        return NULL;
+    }
+
+    // Ajusta o mapeamento reverso ao número real de vértices
+    long long *idsAjustados = (long long *)realloc(mapa->idsExternos, (size_t)mapa->tamanho * sizeof(long long));
+    if (!idsAjustados) {
+        fprintf(stderr, "Erro ao redimensionar o mapeamento de vértices\n");
+        exit(EXIT_FAILURE);
+    }
+    mapa->idsExternos = idsAjustados;
+    mapa->capacidadeIds = mapa->tamanho;
+
+    long long removidas = normalizarArestas(arestas, mapa->tamanho, direcionado);
+    if (arestasRemovidas != NULL) {
+        *arestasRemovidas = removidas;
+    }
+
+    Grafo *grafo = construirGrafoDeArestas(arestas, mapa->tamanho, tipo, direcionado);
+    grafo->mapaIds = mapa;
+
+    liberarBufferArestas(arestas);
+    return grafo;
+}
+
+// Lê um arquivo DIMACS de fluxo máximo:
+//   c <comentário>
+//   p max <n> <m>
+//   n <id> s | n <id> t
+//   a <u> <v> <capacidade>
+// Os vértices são 1-based. A fonte e o sumidouro declarados no arquivo são
+// devolvidos em origem/destino (0-based), ou -1 se ausentes.
+Grafo *lerGrafoDimacs(const char *nomeArquivo, TipoRepresentacao tipo, int *origem, int *destino,
+                      long long *arestasRemovidas) {
+    FILE *arquivo = fopen(nomeArquivo, "r");
+    if (!arquivo) {
+        printf("Erro ao abrir o arquivo %s.\n", nomeArquivo);
+        return NULL;
+    }
+
+    char linha[1024];
+    long long numeroLinha = 0;
+    int numVertices = -1;
+    long long numArestasDeclaradas = 0;
+    BufferArestas *arestas = NULL;
+    int valido = 1;
+    *origem = -1;
+    *destino = -1;
+
+    while (fgets(linha, sizeof(linha), arquivo)) {
+        numeroLinha++;
+        if (linha[0] == 'p') {
+            char problema[16];
+            // Uma segunda linha 'p' redefiniria o número de vértices depois de arcos já lidos
+            if (arestas != NULL) {
+                printf("Erro: linha de problema duplicada no arquivo %s.\n", nomeArquivo);
+                valido = 0;
+                break;
+            }
+            if (sscanf(linha, "p %15s %d %lld", problema, &numVertices, &numArestasDeclaradas) != 3 ||
+                strcmp(problema, "max") != 0 || numVertices <= 0 || numArestasDeclaradas < 0) {
+                printf("Erro: linha de problema inválida no arquivo %s.\n", nomeArquivo);
+                valido = 0;
+                break;
+            }
+            arestas = criarBufferArestas(numArestasDeclaradas < LIMITE_PREALOCACAO_ARESTAS ? numArestasDeclaradas
+                                                                                          : LIMITE_PREALOCACAO_ARESTAS);
+        } else if (linha[0] == 'n') {
+            int id;
+            char papel;
+            if (sscanf(linha, "n %d %c", &id, &papel) != 2 || (papel != 's' && papel != 't')) {
+                printf("Linha %lld ignorada: descritor de vértice 'n' inválido.\n", numeroLinha);
+            } else if (papel == 's') {
+                *origem = id - 1;
+            } else {
+                *destino = id - 1;
+            }
+        } else if (linha[0] == 'a') {
+            int u, v;
+            double capacidade;
+            // Arcos antes da linha 'p' seriam perdidos e o fluxo calculado num grafo truncado
+            if (arestas == NULL) {
+                printf("Erro: arco na linha %lld antes da linha 'p max' no arquivo %s.\n", numeroLinha, nomeArquivo);
+                valido = 0;
+                break;
+            }
+            if (sscanf(linha, "a %d %d %lf", &u, &v, &capacidade) != 3) {
+                printf("Linha %lld ignorada: arco 'a' inválido.\n", numeroLinha);
+                continue;
+            }
+            if (u < 1 || u > numVertices || v < 1 || v > numVertices) {
+                printf("Arco (%d, %d) ignorado: vértice fora do intervalo 1..%d.\n", u, v, numVertices);
+                continue;
+            }
+            inserirArestaBuffer(arestas, u - 1, v - 1, capacidade);
+        }
+        // Linhas 'c' e vazias são ignoradas
+    }
+    fclose(arquivo);
+
+    if (!valido) {
+        if (arestas != NULL) {
+            liberarBufferArestas(arestas);
+        }
+        return NULL;
+    }
+    if (arestas == NULL) {
+        printf("Erro: linha 'p max' ausente no arquivo %s.\n", nomeArquivo);
+        return NULL;
+    }
+    if (*origem >= numVertices || *destino >= numVertices) {
+        *origem = -1;
+        *destino = -1;
+    }
+
+    long long removidas = normalizarArestas(arestas, numVertices, 1);
+    if (arestasRemovidas != NULL) {
+        *arestasRemovidas = removidas;
+    }
+
+    Grafo *grafo = construirGrafoDeArestas(arestas, numVertices, tipo, 1);
+    liberarBufferArestas(arestas);
+    return grafo;
+}
+
+// Lê um arquivo Matrix Market no formato coordenado ("%%MatrixMarket matrix coordinate
+// <real|integer|pattern> <general|symmetric>"). Cada entrada (i, j, valor) vira a aresta
+// i -> j com capacidade igual ao valor (1 no formato pattern). Matrizes simétricas geram
+// grafos não direcionados; as demais, grafos direcionados.
+Grafo *lerGrafoMatrixMarket(const char *nomeArquivo, TipoRepresentacao tipo, long long *arestasRemovidas) {
+    FILE *arquivo = fopen(nomeArquivo, "r");
+    if (!arquivo) {
+        printf("Erro ao abrir o arquivo %s.\n", nomeArquivo);
+        return NULL;
+    }
+
+    char linha[1024];
+    char objeto[32], formato[32], campo[32], simetria[32];
+    if (!fgets(linha, sizeof(linha), arquivo) ||
+        sscanf(linha, "%%%%MatrixMarket %31s %31s %31s %31s", objeto, formato, campo, simetria) != 4 ||
+        strcmp(objeto, "matrix") != 0 || strcmp(formato, "coordinate") != 0) {
+        printf("Erro: cabeçalho Matrix Market inválido ou não coordenado no arquivo %s.\n", nomeArquivo);
+        fclose(arquivo);
+        return NULL;
+    }
+
+    int padrao = strcmp(campo, "pattern") == 0;
+    if (!padrao && strcmp(campo, "real") != 0 && strcmp(campo, "integer") != 0) {
+        printf("Erro: campo Matrix Market '%s' não suportado no arquivo %s.\n", campo, nomeArquivo);
+        fclose(arquivo);
+        return NULL;
+    }
+    int direcionado = strcmp(simetria, "general") == 0;
+    if (!direcionado && strcmp(simetria, "symmetric") != 0) {
+        printf("Erro: simetria Matrix Market '%s' não suportada no arquivo %s.\n", simetria, nomeArquivo);
+        fclose(arquivo);
+        return NULL;
+    }
+
+    // Pula os comentários até a linha de dimensões
+    int linhas = 0, colunas = 0;
+    long long numEntradas = 0;
+    int dimensoesLidas = 0;
+    while (fgets(linha, sizeof(linha), arquivo)) {
+        if (linha[0] == '%') {
+            continue;
+        }
+        if (sscanf(linha, "%d %d %lld", &linhas, &colunas, &numEntradas) == 3) {
+            dimensoesLidas = 1;
+        }
+        break;
+    }
+    if (!dimensoesLidas || linhas <= 0 || colunas <= 0) {
+        printf("Erro: dimensões inválidas no arquivo %s.\n", nomeArquivo);
+        fclose(arquivo);
+        return NULL;
+    }
+
+    int numVertices = linhas > colunas ? linhas : colunas;
+    BufferArestas *arestas =
+        criarBufferArestas(numEntradas < LIMITE_PREALOCACAO_ARESTAS ? numEntradas : LIMITE_PREALOCACAO_ARESTAS);
+    int i, j;
+    double valor = 1.0;
+    while (fgets(linha, sizeof(linha), arquivo)) {
+        if (linha[0] == '%') {
+            continue;
+        }
+        int lidos = padrao ? sscanf(linha, "%d %d", &i, &j) : sscanf(linha, "%d %d %lf", &i, &j, &valor);
+        if (lidos != (padrao ? 2 : 3)) {
+            continue;
+        }
+        if (i < 1 || i > numVertices || j < 1 || j > numVertices) {
+            printf("Entrada (%d, %d) ignorada: índice fora do intervalo 1..%d.\n", i, j, numVertices);
+            continue;
+        }
+        inserirArestaBuffer(arestas, i - 1, j - 1, valor);
+    }
+    fclose(arquivo);
+
+    long long removidas = normalizarArestas(arestas, numVertices, direcionado);
+    if (arestasRemovidas != NULL) {
+        *arestasRemovidas = removidas;
+    }
+
+    Grafo *grafo = construirGrafoDeArestas(arestas, numVertices, tipo, direcionado);
+    liberarBufferArestas(arestas);
+    return grafo;
+}
@@ -0,0 +1,130 @@
+#include "../include/mapa_vertices.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+// Função de espalhamento (finalizador do splitmix64)
+static unsigned long long espalhar(long long chave) {
+    unsigned long long x = (unsigned long long)chave;
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+static void alocarTabela(MapaVertices *mapa, long long capacidade) {
+    mapa->chaves = (long long *)malloc((size_t)capacidade * sizeof(long long));
+    mapa->valores = (int *)malloc((size_t)capacidade * sizeof(int));
+    if (!mapa->chaves || !mapa->valores) {
+        fprintf(stderr, "Erro ao alocar memória para o mapa de vértices\n");
+        exit(EXIT_FAILURE);
+    }
+    for (long long i = 0; i < capacidade; i++) {
+        mapa->valores[i] = -1;
+    }
+    mapa->capacidade = capacidade;
+}
+
+MapaVertices *criarMapaVertices(int capacidadeInicial) {
+    MapaVertices *mapa = (MapaVertices *)malloc(sizeof(MapaVertices));
+    if (!mapa) {
+        fprintf(stderr, "Erro ao alocar memória para o mapa de vértices\n");
+        exit(EXIT_FAILURE);
+    }
+    if (capacidadeInicial < 16) {
+        capacidadeInicial = 16;
+    }
+
+    // Fator de carga máximo de 1/2
+    long long capacidade = 1;
+    while (capacidade < 2LL * capacidadeInicial) {
+        capacidade <<= 1;
+    }
+    alocarTabela(mapa, capacidade);
+
+    mapa->tamanho = 0;
+    mapa->capacidadeIds = capacidadeInicial;
+    mapa->idsExternos = (long long *)malloc((size_t)capacidadeInicial * sizeof(long long));
+    if (!mapa->idsExternos) {
+        fprintf(stderr, "Erro ao alocar memória para o mapa de vértices\n");
+        exit(EXIT_FAILURE);
+    }
+    return mapa;
+}
+
+void liberarMapaVertices(MapaVertices *mapa) {
+    free(mapa->chaves);
+    free(mapa->valores);
+    free(mapa->idsExternos);
+    free(mapa);
+}
+
+// Dobra a tabela e reinsere as chaves existentes
+static void redimensionarMapa(MapaVertices *mapa) {
+    long long *chavesAntigas = mapa->chaves;
+    int *valoresAntigos = mapa->valores;
+    long long capacidadeAntiga = mapa->capacidade;
+
+    alocarTabela(mapa, capacidadeAntiga * 2);
+    unsigned long long mascara = (unsigned long long)mapa->capacidade - 1;
+    for (long long i = 0; i < capacidadeAntiga; i++) {
+        if (valoresAntigos[i] == -1) {
+            continue;
+        }
+        unsigned long long pos = espalhar(chavesAntigas[i]) & mascara;
+        while (mapa->valores[pos] != -1) {
+            pos = (pos + 1) & mascara;
+        }
+        mapa->chaves[pos] = chavesAntigas[i];
+        mapa->valores[pos] = valoresAntigos[i];
+    }
+
+    free(chavesAntigas);
+    free(valoresAntigos);
+}
+
+// Retorna o índice interno do ID externo, criando um novo índice se ainda não existir
+int obterOuInserirVertice(MapaVertices *mapa, long long idExterno) {
+    unsigned long long mascara = (unsigned long long)mapa->capacidade - 1;
+    unsigned long long pos = espalhar(idExterno) & mascara;
+    while (mapa->valores[pos] != -1) {
+        if (mapa->chaves[pos] == idExterno) {
+            return mapa->valores[pos];
+        }
+        pos = (pos + 1) & mascara;
+    }
+
+    int indice = mapa->tamanho++;
+    mapa->chaves[pos] = idExterno;
+    mapa->valores[pos] = indice;
+
+    // Guarda o mapeamento reverso
+    if (indice >= mapa->capacidadeIds) {
+        mapa->capacidadeIds *= 2;
+        mapa->idsExternos = (long long *)realloc(mapa->idsExternos, (size_t)mapa->capacidadeIds * sizeof(long long));
+        if (!mapa->idsExternos) {
+            fprintf(stderr, "Erro ao alocar memória para o mapa de vértices\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    mapa->idsExternos[indice] = idExterno;
+
+    if (2LL * mapa->tamanho > mapa->capacidade) {
+        redimensionarMapa(mapa);
+    }
+    return indice;
+}
+
+// Retorna o índice interno do ID externo, ou -1 se ele não existir
+int buscarVertice(const MapaVertices *mapa, long long idExterno) {
+    unsigned long long mascara = (unsigned long long)mapa->capacidade - 1;
+    unsigned long long pos = espalhar(idExterno) & mascara;
+    while (mapa->valores[pos] != -1) {
+        if (mapa->chaves[pos] == idExterno) {
+            return mapa->valores[pos];
+        }
+        pos = (pos + 1) & mascara;
+    }
+    return -1;
+}
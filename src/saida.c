@@ -0,0 +1,211 @@
+#include "../include/saida.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <float.h>
+
+// Cabeçalhos dos formatos binários
+#define MAGICO_ARVORE "GRFA"
+#define MAGICO_DISTANCIAS "GRFD"
+#define MAGICO_IDS "GRFI"
+
+// Retorna o ID externo do vértice
+static long long rotulo(const long long *idsExternos, int vertice) {
+    return idsExternos != NULL ? idsExternos[vertice] : vertice + 1;
+}
+
+// Seção opcional com a tabela de IDs externos: "GRFI", int64 ids[n]
+static void escreverIdsBinarios(BufferSaida *buffer, const long long *idsExternos, int numVertices) {
+    if (idsExternos == NULL) {
+        return;
+    }
+    escreverBytes(buffer, MAGICO_IDS, 4);
+    escreverBytes(buffer, idsExternos, (size_t)numVertices * sizeof(long long));
+}
+
+// Cria um buffer de saída associado a um arquivo já aberto
+BufferSaida *criarBufferSaida(FILE *arquivo, size_t capacidade) {
+    BufferSaida *buffer = (BufferSaida *)malloc(sizeof(BufferSaida));
+    if (!buffer) {
+        fprintf(stderr, "Erro ao alocar memória para o buffer de saída\n");
+        exit(EXIT_FAILURE);
+    }
+    // Garante espaço para o maior inteiro formatado
+    if (capacidade < 64) {
+        capacidade = 64;
+    }
+    buffer->dados = (char *)malloc(capacidade);
+    if (!buffer->dados) {
+        fprintf(stderr, "Erro ao alocar memória para os dados do buffer de saída\n");
+        exit(EXIT_FAILURE);
+    }
+    buffer->arquivo = arquivo;
+    buffer->usado = 0;
+    buffer->capacidade = capacidade;
+    return buffer;
+}
+
+// Escreve o conteúdo acumulado no arquivo com uma única chamada
+void descarregarBufferSaida(BufferSaida *buffer) {
+    if (buffer->usado > 0) {
+        fwrite(buffer->dados, 1, buffer->usado, buffer->arquivo);
+        buffer->usado = 0;
+    }
+}
+
+// Descarrega o buffer e libera a memória (o arquivo não é fechado)
+void liberarBufferSaida(BufferSaida *buffer) {
+    descarregarBufferSaida(buffer);
+    free(buffer->dados);
+    free(buffer);
+}
+
+void escreverBytes(BufferSaida *buffer, const void *dados, size_t tamanho) {
+    if (buffer->usado + tamanho > buffer->capacidade) {
+        descarregarBufferSaida(buffer);
+        // Blocos maiores que o buffer vão direto para o arquivo
+        if (tamanho > buffer->capacidade) {
+            fwrite(dados, 1, tamanho, buffer->arquivo);
+            return;
+        }
+    }
+    memcpy(buffer->dados + buffer->usado, dados, tamanho);
+    buffer->usado += tamanho;
+}
+
+void escreverTexto(BufferSaida *buffer, const char *texto) {
+    escreverBytes(buffer, texto, strlen(texto));
+}
+
+// Formata um inteiro em decimal sem passar pelo printf
+void escreverInteiro(BufferSaida *buffer, long long valor) {
+    char digitos[24];
+    int pos = sizeof(digitos);
+    unsigned long long absoluto = valor < 0 ? 0ULL - (unsigned long long)valor : (unsigned long long)valor;
+
+    do {
+        digitos[--pos] = (char)('0' + absoluto % 10);
+        absoluto /= 10;
+    } while (absoluto > 0);
+
+    if (valor < 0) {
+        digitos[--pos] = '-';
+    }
+    escreverBytes(buffer, digitos + pos, sizeof(digitos) - pos);
+}
+
+// Escreve um número real com duas casas decimais
+void escreverReal(BufferSaida *buffer, double valor) {
+    char texto[64];
+    int tamanho = snprintf(texto, sizeof(texto), "%.2f", valor);
+    if (tamanho > 0) {
+        escreverBytes(buffer, texto, (size_t)tamanho < sizeof(texto) ? (size_t)tamanho : sizeof(texto) - 1);
+    }
+}
+
+// Escreve uma linha da árvore de busca no formato "Vértice: x, Pai: y, Nível: z"
+void escreverLinhaArvore(BufferSaida *buffer, long long vertice, long long pai, int nivel) {
+    escreverTexto(buffer, "Vértice: ");
+    escreverInteiro(buffer, vertice);
+    escreverTexto(buffer, ", Pai: ");
+    escreverInteiro(buffer, pai);
+    escreverTexto(buffer, ", Nível: ");
+    escreverInteiro(buffer, nivel);
+    escreverBytes(buffer, "\n", 1);
+}
+
+// Formato binário da árvore: "GRFA", int32 numVertices, int32 pais[n], int32 niveis[n],
+// seguido da seção "GRFI" quando os IDs são esparsos. Vértices fora da árvore têm pai e
+// nível -1.
+void escreverArvoreBinaria(BufferSaida *buffer, const int *pais, const int *niveis, int numVertices,
+                           const long long *idsExternos) {
+    int32_t n = numVertices;
+    escreverBytes(buffer, MAGICO_ARVORE, 4);
+    escreverBytes(buffer, &n, sizeof(n));
+    for (int i = 0; i < numVertices; i++) {
+        int32_t pai = pais[i];
+        escreverBytes(buffer, &pai, sizeof(pai));
+    }
+    for (int i = 0; i < numVertices; i++) {
+        int32_t nivel = niveis[i];
+        escreverBytes(buffer, &nivel, sizeof(nivel));
+    }
+    escreverIdsBinarios(buffer, idsExternos, numVertices);
+}
+
+// Formato binário das distâncias: "GRFD", int32 numVertices, int32 origem,
+// double distancia[n] (DBL_MAX para inacessível), int32 pais[n], seguido da seção "GRFI"
+// quando os IDs são esparsos
+void escreverDistanciasBinarias(BufferSaida *buffer, int origem, const double *distancia, const int *pais,
+                                int numVertices, const long long *idsExternos) {
+    int32_t n = numVertices;
+    int32_t o = origem;
+    escreverBytes(buffer, MAGICO_DISTANCIAS, 4);
+    escreverBytes(buffer, &n, sizeof(n));
+    escreverBytes(buffer, &o, sizeof(o));
+    escreverBytes(buffer, distancia, (size_t)numVertices * sizeof(double));
+    for (int i = 0; i < numVertices; i++) {
+        int32_t pai = pais[i];
+        escreverBytes(buffer, &pai, sizeof(pai));
+    }
+    escreverIdsBinarios(buffer, idsExternos, numVertices);
+}
+
+// Escreve as distâncias mínimas e os caminhos a partir da origem
+void escreverCaminhosMinimos(BufferSaida *buffer, int origem, const double *distancia, const int *pais,
+                             int numVertices, const long long *idsExternos, FormatoSaida formato) {
+    if (formato == SAIDA_BINARIA) {
+        escreverDistanciasBinarias(buffer, origem, distancia, pais, numVertices, idsExternos);
+        return;
+    }
+
+    // Um único vetor no heap para reconstruir os caminhos (evita VLA na pilha)
+    int *caminho = (int *)malloc((size_t)numVertices * sizeof(int));
+    if (!caminho) {
+        fprintf(stderr, "Erro ao alocar memória para o caminho\n");
+        exit(EXIT_FAILURE);
+    }
+
+    escreverTexto(buffer, "Distâncias mínimas a partir do vértice ");
+    escreverInteiro(buffer, rotulo(idsExternos, origem));
+    escreverTexto(buffer, ":\n");
+    for (int i = 0; i < numVertices; i++) {
+        escreverTexto(buffer, "Vértice ");
+        escreverInteiro(buffer, rotulo(idsExternos, i));
+        if (distancia[i] == DBL_MAX) {
+            escreverTexto(buffer, ": Inacessível\n");
+            continue;
+        }
+        escreverTexto(buffer, ": ");
+        escreverReal(buffer, distancia[i]);
+        escreverTexto(buffer, " (Caminho: ");
+
+        // Reconstruir o caminho
+        int tamanhoCaminho = 0;
+        for (int v = i; v != -1 && tamanhoCaminho < numVertices; v = pais[v]) {
+            caminho[tamanhoCaminho++] = v;
+        }
+        // Escrever o caminho na ordem correta
+        for (int j = tamanhoCaminho - 1; j >= 0; j--) {
+            escreverInteiro(buffer, rotulo(idsExternos, caminho[j]));
+            if (j > 0) {
+                escreverTexto(buffer, " -> ");
+            }
+        }
+        escreverTexto(buffer, ")\n");
+    }
+
+    free(caminho);
+}
+
+// Escreve as distâncias e os caminhos na saída padrão no formato pedido por 'imprimir'
+void imprimirCaminhosMinimos(int imprimir, int origem, const double *distancia, const int *pais, int numVertices,
+                             const long long *idsExternos) {
+    if (!imprimir) {
+        return;
+    }
+    BufferSaida *saida = criarBufferSaida(stdout, TAMANHO_BUFFER_SAIDA);
+    escreverCaminhosMinimos(saida, origem, distancia, pais, numVertices, idsExternos,
+                            imprimir == IMPRIMIR_BINARIO ? SAIDA_BINARIA : SAIDA_TEXTO);
+    liberarBufferSaida(saida);
+}